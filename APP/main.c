@@ -17,6 +17,7 @@ Description  : Source file to test all STM32F401 device drivers.
 #include "../MCAL/RCC/INCLUDES/rcc.h"
 #include "../MCAL/GPIO/INCLUDES/gpio.h"
 #include "../MCAL/UART/INCLUDES/uart.h"
+#include "../MCAL/SYSTICK/INCLUDES/systick.h"
 
 /*=====================================================================================================================
                                            < Global Variables >
@@ -51,11 +52,12 @@ int main(void)
     GPIO_setPinFunction(GPIO_PORTA_ID,GPIO_PIN03_ID,GPIO_ALTERNATE_FUNCTION_07);
 
     UART_init(UART2_ID,&LOC_configUART);
+    SYSTICK_init(SYSTICK_CPU_CLOCK);
 
     while(1)
     {
         UART_sendString(UART2_ID,"Mamoun was here!");
-        for(uint32 counter = 0; counter < 2000000; counter++);
+        SYSTICK_setBusyWait(500);
     }
 }
 
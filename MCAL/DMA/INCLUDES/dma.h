@@ -0,0 +1,189 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DMA
+File Name    : dma.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the STM32F401xx DMA peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_DMA_INCLUDES_DMA_H_
+#define MCAL_DMA_INCLUDES_DMA_H_
+
+/*=====================================================================================================================
+                                       < User-defined Data Types >
+=====================================================================================================================*/
+
+typedef enum
+{
+    DMA_NO_ERRORS,                           /* All Good.                     */
+    DMA_BUSY_ERROR,                          /* The stream is busy.           */
+    DMA_NULL_PTR_ERROR,                      /* Null Pointer Error.           */
+    DMA_STREAM_ID_ERROR,                     /* Wrong Stream ID Error.        */
+    DMA_CHANNEL_ID_ERROR,                    /* Wrong Channel ID Error.       */
+    DMA_CONTROLLER_ID_ERROR,                 /* Wrong Controller ID Error.    */
+    DMA_CONFIGURATIONS_ERROR,                /* Wrong Configurations Error.   */
+    DMA_FUNCTION_TIMEOUT_ERROR,              /* Function Timeout Ended Error. */
+}DMA_errorStatusType;
+
+typedef enum
+{
+    DMA1_ID,                                 /* DMA1 Controller ID. */
+    DMA2_ID,                                 /* DMA2 Controller ID. */
+}DMA_controllerIDType;
+
+typedef enum
+{
+    DMA_STREAM0_ID,                          /* DMAx Stream 0 ID. */
+    DMA_STREAM1_ID,                          /* DMAx Stream 1 ID. */
+    DMA_STREAM2_ID,                          /* DMAx Stream 2 ID. */
+    DMA_STREAM3_ID,                          /* DMAx Stream 3 ID. */
+    DMA_STREAM4_ID,                          /* DMAx Stream 4 ID. */
+    DMA_STREAM5_ID,                          /* DMAx Stream 5 ID. */
+    DMA_STREAM6_ID,                          /* DMAx Stream 6 ID. */
+    DMA_STREAM7_ID,                          /* DMAx Stream 7 ID. */
+}DMA_streamIDType;
+
+typedef enum
+{
+    DMA_CHANNEL0_ID,                         /* Stream Request Channel 0 ID. */
+    DMA_CHANNEL1_ID,                         /* Stream Request Channel 1 ID. */
+    DMA_CHANNEL2_ID,                         /* Stream Request Channel 2 ID. */
+    DMA_CHANNEL3_ID,                         /* Stream Request Channel 3 ID. */
+    DMA_CHANNEL4_ID,                         /* Stream Request Channel 4 ID. */
+    DMA_CHANNEL5_ID,                         /* Stream Request Channel 5 ID. */
+    DMA_CHANNEL6_ID,                         /* Stream Request Channel 6 ID. */
+    DMA_CHANNEL7_ID,                         /* Stream Request Channel 7 ID. */
+}DMA_channelIDType;
+
+typedef enum
+{
+    DMA_PERIPHERAL_TO_MEMORY,                /* Transfer data from a peripheral to the memory.   */
+    DMA_MEMORY_TO_PERIPHERAL,                /* Transfer data from the memory to a peripheral.   */
+    DMA_MEMORY_TO_MEMORY,                    /* Transfer data from the memory to the memory.     */
+}DMA_transferDirectionType;
+
+typedef enum
+{
+    DMA_NORMAL_MODE,                         /* The stream stops after transferring all the data.      */
+    DMA_CIRCULAR_MODE,                       /* The stream reloads and restarts after each transfer.   */
+}DMA_transferModeType;
+
+typedef enum
+{
+    DMA_BYTE_SIZE,                           /* Each data item is 8-bit.  */
+    DMA_HALF_WORD_SIZE,                      /* Each data item is 16-bit. */
+    DMA_WORD_SIZE,                           /* Each data item is 32-bit. */
+}DMA_dataSizeType;
+
+typedef enum
+{
+    DMA_FIXED_ADDRESS,                       /* The address is fixed during the transfer.             */
+    DMA_INCREMENTED_ADDRESS,                 /* The address is incremented after each data item.     */
+}DMA_addressModeType;
+
+typedef enum
+{
+    DMA_LOW_PRIORITY,                        /* Low priority stream.       */
+    DMA_MEDIUM_PRIORITY,                     /* Medium priority stream.    */
+    DMA_HIGH_PRIORITY,                       /* High priority stream.      */
+    DMA_VERY_HIGH_PRIORITY,                  /* Very high priority stream. */
+}DMA_priorityType;
+
+typedef enum
+{
+    DMA_NO_INTERRUPTS                = 0X00, /* No interrupts enabled.                                     */
+    DMA_TRANSFER_ERROR_INTERRUPT     = 0X04, /* Interrupt when a transfer error occurs.                    */
+    DMA_HALF_TRANSFER_INTERRUPT      = 0X08, /* Interrupt when half of the data has been transferred.      */
+    DMA_TRANSFER_COMPLETE_INTERRUPT  = 0X10, /* Interrupt when all the data has been transferred.          */
+}DMA_interruptType;
+
+typedef struct
+{
+    DMA_controllerIDType controllerID;       /* DMA Controller ID [DMA1 - DMA2].                                       */
+    DMA_streamIDType streamID;               /* Stream ID [0 ~ 7].                                                     */
+    DMA_channelIDType channelID;             /* Request Channel ID [0 ~ 7] according to the DMA request mapping.       */
+    DMA_transferDirectionType direction;     /* Transfer Direction [Peripheral to Memory - Memory to Peripheral ...].  */
+    DMA_transferModeType transferMode;       /* Transfer Mode [Normal - Circular].                                     */
+    DMA_dataSizeType dataSize;               /* Data Item Size [Byte - Half Word - Word].                              */
+    DMA_addressModeType memoryAddressMode;   /* Memory Address Mode [Fixed - Incremented].                             */
+    DMA_addressModeType peripheralAddressMode;/* Peripheral Address Mode [Fixed - Incremented].                        */
+    DMA_priorityType priority;               /* Stream Priority [Low - Medium - High - Very High].                     */
+    uint8 interrupts;                        /* The enabled interrupts [ORing of DMA_interruptType values].            */
+}DMA_streamConfigurationsType;
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_configureStream
+ * [Description]   : Configure a specific DMA stream with specific configurations.
+ * [Arguments]     : <a_ptr2configurations>      -> Pointer to a structure that holds the configurations.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ *                                                          - Channel ID Error.
+ *                                                          - Configurations Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_configureStream(DMA_streamConfigurationsType* a_ptr2configurations);
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_startTransfer
+ * [Description]   : Start a transfer on a specific configured DMA stream.
+ * [Arguments]     : <a_controllerID>        -> Indicates to the required DMA controller.
+ *                   <a_streamID>            -> Indicates to the required stream.
+ *                   <a_sourceAddress>       -> Indicates to the address of the source.
+ *                   <a_destinationAddress>  -> Indicates to the address of the destination.
+ *                   <a_dataLength>          -> Indicates to the number of data items to be transferred.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ *                                                          - Configurations Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_startTransfer(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID, uint32 a_sourceAddress, uint32 a_destinationAddress, uint16 a_dataLength);
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_stopTransfer
+ * [Description]   : Stop the current transfer on a specific DMA stream.
+ * [Arguments]     : <a_controllerID>        -> Indicates to the required DMA controller.
+ *                   <a_streamID>            -> Indicates to the required stream.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_stopTransfer(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID);
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_getRemainingData
+ * [Description]   : Get the number of the remaining data items in the current transfer of a specific DMA stream.
+ * [Arguments]     : <a_controllerID>          -> Indicates to the required DMA controller.
+ *                   <a_streamID>              -> Indicates to the required stream.
+ *                   <a_ptr2remainingData>     -> Pointer to variable to store the number of remaining data items.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_getRemainingData(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID, uint16* a_ptr2remainingData);
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_setCallBackFunction
+ * [Description]   : Set the address of the call-back function for a specific DMA stream.
+ * [Arguments]     : <a_controllerID>          -> Indicates to the required DMA controller.
+ *                   <a_streamID>              -> Indicates to the required stream.
+ *                   <a_ptr2callBackFunction>  -> Pointer to the call-back function [takes the interrupt event].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_setCallBackFunction(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID, void (*a_ptr2callBackFunction)(DMA_interruptType));
+
+#endif /* MCAL_DMA_INCLUDES_DMA_H_ */
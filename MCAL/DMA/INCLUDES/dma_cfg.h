@@ -0,0 +1,22 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DMA
+File Name    : dma_cfg.h
+Date Created : Oct 17, 2026
+Description  : Configuration file for the STM32F401xx DMA peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_DMA_INCLUDES_DMA_CFG_H_
+#define MCAL_DMA_INCLUDES_DMA_CFG_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* Set the number of polls to wait for a stream to be disabled before reporting a timeout error [1 ~ 4294967295]. */
+#define DMA_FUNCTION_TIMEOUT_VALUE             (100000UL)
+
+#endif /* MCAL_DMA_INCLUDES_DMA_CFG_H_ */
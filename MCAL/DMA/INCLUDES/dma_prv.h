@@ -0,0 +1,89 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DMA
+File Name    : dma_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the STM32F401xx DMA peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_DMA_INCLUDES_DMA_PRV_H_
+#define MCAL_DMA_INCLUDES_DMA_PRV_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+#define DMA_NUMBER_OF_CONTROLLERS                    (2U)      /* The number of DMA controllers in the chip.       */
+#define DMA_NUMBER_OF_STREAMS                        (8U)      /* The number of streams in each DMA controller.    */
+#define DMA_STREAMS_PER_STATUS_REGISTER              (4U)      /* The number of streams in each ISR/IFCR register. */
+
+/*=====================================================================================================================
+                                       < User-defined Data Types >
+=====================================================================================================================*/
+
+typedef struct
+{
+    volatile uint32 CR;                              /* DMA stream x configuration register.        */
+    volatile uint32 NDTR;                            /* DMA stream x number of data register.       */
+    volatile uint32 PAR;                             /* DMA stream x peripheral address register.   */
+    volatile uint32 M0AR;                            /* DMA stream x memory 0 address register.     */
+    volatile uint32 M1AR;                            /* DMA stream x memory 1 address register.     */
+    volatile uint32 FCR;                             /* DMA stream x FIFO control register.         */
+}DMA_streamRegistersType;
+
+typedef struct
+{
+    volatile uint32 ISR[2];                          /* DMA low and high interrupt status registers.      */
+    volatile uint32 IFCR[2];                         /* DMA low and high interrupt flag clear registers.  */
+    DMA_streamRegistersType S[DMA_NUMBER_OF_STREAMS];/* DMA streams registers.                            */
+}DMAx_registersType;
+
+/*=====================================================================================================================
+                                < Peripheral Registers and Bits Definitions >
+=====================================================================================================================*/
+
+/* All DMA controllers base addresss. */
+#define DMA1                                         ((volatile DMAx_registersType*)0X40026000)
+#define DMA2                                         ((volatile DMAx_registersType*)0X40026400)
+
+/* CR register fields and bits number. */
+#define DMA_SxCR_EN_BIT                              (0UL)
+#define DMA_SxCR_TEIE_BIT                            (2UL)
+#define DMA_SxCR_HTIE_BIT                            (3UL)
+#define DMA_SxCR_TCIE_BIT                            (4UL)
+#define DMA_SxCR_DIR_FIELD                           (6UL)
+#define DMA_SxCR_CIRC_BIT                            (8UL)
+#define DMA_SxCR_PINC_BIT                            (9UL)
+#define DMA_SxCR_MINC_BIT                            (10UL)
+#define DMA_SxCR_PSIZE_FIELD                         (11UL)
+#define DMA_SxCR_MSIZE_FIELD                         (13UL)
+#define DMA_SxCR_PL_FIELD                            (16UL)
+#define DMA_SxCR_CHSEL_FIELD                         (25UL)
+
+/* FCR register fields and bits number. */
+#define DMA_SxFCR_FTH_FIELD                          (0UL)
+#define DMA_SxFCR_DMDIS_BIT                          (2UL)
+
+/* The interrupt enable bits in the CR register [TEIE - HTIE - TCIE]. */
+#define DMA_SxCR_INTERRUPTS_MASK                     (0X1CUL)
+
+/* The stream flags in the ISR/IFCR registers [FEIF - DMEIF - TEIF - HTIF - TCIF]. */
+#define DMA_STREAM_FLAGS_MASK                        (0X3DUL)
+
+/* The FIFO threshold used in the memory-to-memory transfers [Full FIFO]. */
+#define DMA_FIFO_FULL_THRESHOLD                      (0X03UL)
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the index of the ISR/IFCR register that holds the flags of a specific stream [0: Low - 1: High]. */
+#define DMA_GET_FLAGS_REGISTER(STREAM)       ((uint32)(STREAM) / DMA_STREAMS_PER_STATUS_REGISTER)
+
+/* Get the position of the flags of a specific stream in its ISR/IFCR register [0 - 6 - 16 - 22]. */
+#define DMA_GET_FLAGS_OFFSET(STREAM)         ((((uint32)(STREAM) & 0X01UL) * 6UL) + (((uint32)(STREAM) & 0X02UL) * 8UL))
+
+#endif /* MCAL_DMA_INCLUDES_DMA_PRV_H_ */
@@ -0,0 +1,399 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DMA
+File Name    : dma.c
+Date Created : Oct 17, 2026
+Description  : Source file for the STM32F401xx DMA peripheral driver.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../../OTHERS/std_types.h"
+#include "../../../OTHERS/common_macros.h"
+#include "../INCLUDES/dma_prv.h"
+#include "../INCLUDES/dma_cfg.h"
+#include "../INCLUDES/dma.h"
+#include "../../DWT/INCLUDES/dwt.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* Array of pointers to function stores the addresses of the call-back functions of all streams. */
+static void (*G_callBackFunctionsArray[DMA_NUMBER_OF_CONTROLLERS][DMA_NUMBER_OF_STREAMS])(DMA_interruptType) = {{NULL_PTR}};
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_disableStream
+ * [Description]   : Disable a specific DMA stream and wait until the hardware confirms that it is disabled.
+ * [Arguments]     : <a_ptr2stream>      -> Pointer to the registers of the required stream.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+static DMA_errorStatusType DMA_disableStream(DMA_streamRegistersType* a_ptr2stream)
+{
+    DMA_errorStatusType LOC_errorStatus = DMA_NO_ERRORS;
+    uint32 LOC_functionTimeout = DMA_FUNCTION_TIMEOUT_VALUE;
+
+    /* Disable the stream, the current transfer stops after the current data item. */
+    CLEAR_BIT(a_ptr2stream->CR,DMA_SxCR_EN_BIT);
+    /* Wait until the stream enable bit is cleared by hardware or the function's timeout has ended. */
+    while((BIT_IS_SET(a_ptr2stream->CR,DMA_SxCR_EN_BIT)) && (--LOC_functionTimeout));
+    /* If the function's timeout has ended, return the Function Timeout error. */
+    if(LOC_functionTimeout == 0) LOC_errorStatus = DMA_FUNCTION_TIMEOUT_ERROR;
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_clearStreamFlags
+ * [Description]   : Clear all the status flags of a specific DMA stream.
+ * [Arguments]     : <a_ptr2DMAx>        -> Pointer to the registers of the required DMA controller.
+ *                   <a_streamID>        -> Indicates to the required stream.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void DMA_clearStreamFlags(DMAx_registersType* a_ptr2DMAx, DMA_streamIDType a_streamID)
+{
+    /* The IFCR register is write-1-to-clear, so writing the stream mask does not affect the other streams. */
+    a_ptr2DMAx->IFCR[DMA_GET_FLAGS_REGISTER(a_streamID)] = (DMA_STREAM_FLAGS_MASK << DMA_GET_FLAGS_OFFSET(a_streamID));
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_configureStream
+ * [Description]   : Configure a specific DMA stream with specific configurations.
+ * [Arguments]     : <a_ptr2configurations>      -> Pointer to a structure that holds the configurations.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ *                                                          - Channel ID Error.
+ *                                                          - Configurations Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_configureStream(DMA_streamConfigurationsType* a_ptr2configurations)
+{
+    DMA_errorStatusType LOC_errorStatus = DMA_NO_ERRORS;
+    DMAx_registersType* LOC_ptr2DMAx[DMA_NUMBER_OF_CONTROLLERS] = {DMA1,DMA2};
+
+    if(a_ptr2configurations == NULL_PTR)
+    {
+        LOC_errorStatus = DMA_NULL_PTR_ERROR;
+    }
+
+    else if((a_ptr2configurations->controllerID != DMA1_ID) && (a_ptr2configurations->controllerID != DMA2_ID))
+    {
+        LOC_errorStatus = DMA_CONTROLLER_ID_ERROR;
+    }
+
+    else if((a_ptr2configurations->streamID < DMA_STREAM0_ID) || (a_ptr2configurations->streamID > DMA_STREAM7_ID))
+    {
+        LOC_errorStatus = DMA_STREAM_ID_ERROR;
+    }
+
+    else if((a_ptr2configurations->channelID < DMA_CHANNEL0_ID) || (a_ptr2configurations->channelID > DMA_CHANNEL7_ID))
+    {
+        LOC_errorStatus = DMA_CHANNEL_ID_ERROR;
+    }
+
+    else if((a_ptr2configurations->direction > DMA_MEMORY_TO_MEMORY) || \
+            (a_ptr2configurations->transferMode > DMA_CIRCULAR_MODE) || \
+            (a_ptr2configurations->dataSize > DMA_WORD_SIZE) || \
+            (a_ptr2configurations->memoryAddressMode > DMA_INCREMENTED_ADDRESS) || \
+            (a_ptr2configurations->peripheralAddressMode > DMA_INCREMENTED_ADDRESS) || \
+            (a_ptr2configurations->priority > DMA_VERY_HIGH_PRIORITY) || \
+            (a_ptr2configurations->interrupts & (~DMA_SxCR_INTERRUPTS_MASK)))
+    {
+        LOC_errorStatus = DMA_CONFIGURATIONS_ERROR;
+    }
+
+    /* Only DMA2 is able to perform memory-to-memory transfers, and they can not be circular. */
+    else if((a_ptr2configurations->direction == DMA_MEMORY_TO_MEMORY) && \
+           ((a_ptr2configurations->controllerID != DMA2_ID) || (a_ptr2configurations->transferMode == DMA_CIRCULAR_MODE)))
+    {
+        LOC_errorStatus = DMA_CONFIGURATIONS_ERROR;
+    }
+
+    else
+    {
+        DMAx_registersType* LOC_ptr2controller = *(LOC_ptr2DMAx + a_ptr2configurations->controllerID);
+        DMA_streamRegistersType* LOC_ptr2stream = &(LOC_ptr2controller->S[a_ptr2configurations->streamID]);
+
+        /* The stream registers can be written only while the stream is disabled. */
+        LOC_errorStatus = DMA_disableStream(LOC_ptr2stream);
+
+        if(LOC_errorStatus == DMA_NO_ERRORS)
+        {
+            /* Clear any old flags of the stream before the new configurations. */
+            DMA_clearStreamFlags(LOC_ptr2controller,a_ptr2configurations->streamID);
+
+            /* Set the channel, the priority, the data sizes, the address modes, the transfer mode and the direction. */
+            LOC_ptr2stream->CR = (((uint32)a_ptr2configurations->channelID << DMA_SxCR_CHSEL_FIELD)             | \
+                                  ((uint32)a_ptr2configurations->priority << DMA_SxCR_PL_FIELD)                 | \
+                                  ((uint32)a_ptr2configurations->dataSize << DMA_SxCR_MSIZE_FIELD)              | \
+                                  ((uint32)a_ptr2configurations->dataSize << DMA_SxCR_PSIZE_FIELD)              | \
+                                  ((uint32)a_ptr2configurations->memoryAddressMode << DMA_SxCR_MINC_BIT)        | \
+                                  ((uint32)a_ptr2configurations->peripheralAddressMode << DMA_SxCR_PINC_BIT)    | \
+                                  ((uint32)a_ptr2configurations->transferMode << DMA_SxCR_CIRC_BIT)             | \
+                                  ((uint32)a_ptr2configurations->direction << DMA_SxCR_DIR_FIELD)               | \
+                                  ((uint32)a_ptr2configurations->interrupts & DMA_SxCR_INTERRUPTS_MASK));
+
+            /* The memory-to-memory transfers require the FIFO, the other directions use the direct mode. */
+            if(a_ptr2configurations->direction == DMA_MEMORY_TO_MEMORY)
+            {
+                LOC_ptr2stream->FCR = ((1UL << DMA_SxFCR_DMDIS_BIT) | (DMA_FIFO_FULL_THRESHOLD << DMA_SxFCR_FTH_FIELD));
+            }
+
+            else
+            {
+                LOC_ptr2stream->FCR = 0UL;
+            }
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_startTransfer
+ * [Description]   : Start a transfer on a specific configured DMA stream.
+ * [Arguments]     : <a_controllerID>        -> Indicates to the required DMA controller.
+ *                   <a_streamID>            -> Indicates to the required stream.
+ *                   <a_sourceAddress>       -> Indicates to the address of the source.
+ *                   <a_destinationAddress>  -> Indicates to the address of the destination.
+ *                   <a_dataLength>          -> Indicates to the number of data items to be transferred.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ *                                                          - Configurations Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_startTransfer(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID, uint32 a_sourceAddress, uint32 a_destinationAddress, uint16 a_dataLength)
+{
+    DMA_errorStatusType LOC_errorStatus = DMA_NO_ERRORS;
+    DMAx_registersType* LOC_ptr2DMAx[DMA_NUMBER_OF_CONTROLLERS] = {DMA1,DMA2};
+
+    if((a_controllerID != DMA1_ID) && (a_controllerID != DMA2_ID))
+    {
+        LOC_errorStatus = DMA_CONTROLLER_ID_ERROR;
+    }
+
+    else if((a_streamID < DMA_STREAM0_ID) || (a_streamID > DMA_STREAM7_ID))
+    {
+        LOC_errorStatus = DMA_STREAM_ID_ERROR;
+    }
+
+    else if(a_dataLength == 0)
+    {
+        LOC_errorStatus = DMA_CONFIGURATIONS_ERROR;
+    }
+
+    else if(BIT_IS_SET((*(LOC_ptr2DMAx + a_controllerID))->S[a_streamID].CR,DMA_SxCR_EN_BIT))
+    {
+        LOC_errorStatus = DMA_BUSY_ERROR;
+    }
+
+    else
+    {
+        DMA_streamRegistersType* LOC_ptr2stream = &((*(LOC_ptr2DMAx + a_controllerID))->S[a_streamID]);
+
+        /* In the memory-to-peripheral direction the source is the memory, otherwise the source is in PAR. */
+        if((((LOC_ptr2stream->CR >> DMA_SxCR_DIR_FIELD) & 0X03UL)) == DMA_MEMORY_TO_PERIPHERAL)
+        {
+            LOC_ptr2stream->M0AR = a_sourceAddress;
+            LOC_ptr2stream->PAR = a_destinationAddress;
+        }
+
+        else
+        {
+            LOC_ptr2stream->PAR = a_sourceAddress;
+            LOC_ptr2stream->M0AR = a_destinationAddress;
+        }
+
+        /* Set the number of data items, clear the old flags and enable the stream to start the transfer. */
+        LOC_ptr2stream->NDTR = a_dataLength;
+        DMA_clearStreamFlags(*(LOC_ptr2DMAx + a_controllerID),a_streamID);
+        SET_BIT(LOC_ptr2stream->CR,DMA_SxCR_EN_BIT);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_stopTransfer
+ * [Description]   : Stop the current transfer on a specific DMA stream.
+ * [Arguments]     : <a_controllerID>        -> Indicates to the required DMA controller.
+ *                   <a_streamID>            -> Indicates to the required stream.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_stopTransfer(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID)
+{
+    DMA_errorStatusType LOC_errorStatus = DMA_NO_ERRORS;
+    DMAx_registersType* LOC_ptr2DMAx[DMA_NUMBER_OF_CONTROLLERS] = {DMA1,DMA2};
+
+    if((a_controllerID != DMA1_ID) && (a_controllerID != DMA2_ID))
+    {
+        LOC_errorStatus = DMA_CONTROLLER_ID_ERROR;
+    }
+
+    else if((a_streamID < DMA_STREAM0_ID) || (a_streamID > DMA_STREAM7_ID))
+    {
+        LOC_errorStatus = DMA_STREAM_ID_ERROR;
+    }
+
+    else
+    {
+        /* Disable the stream and clear its flags, so the stopped transfer does not fire a late interrupt. */
+        LOC_errorStatus = DMA_disableStream(&((*(LOC_ptr2DMAx + a_controllerID))->S[a_streamID]));
+        DMA_clearStreamFlags(*(LOC_ptr2DMAx + a_controllerID),a_streamID);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_getRemainingData
+ * [Description]   : Get the number of the remaining data items in the current transfer of a specific DMA stream.
+ * [Arguments]     : <a_controllerID>          -> Indicates to the required DMA controller.
+ *                   <a_streamID>              -> Indicates to the required stream.
+ *                   <a_ptr2remainingData>     -> Pointer to variable to store the number of remaining data items.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_getRemainingData(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID, uint16* a_ptr2remainingData)
+{
+    DMA_errorStatusType LOC_errorStatus = DMA_NO_ERRORS;
+    DMAx_registersType* LOC_ptr2DMAx[DMA_NUMBER_OF_CONTROLLERS] = {DMA1,DMA2};
+
+    if((a_controllerID != DMA1_ID) && (a_controllerID != DMA2_ID))
+    {
+        LOC_errorStatus = DMA_CONTROLLER_ID_ERROR;
+    }
+
+    else if((a_streamID < DMA_STREAM0_ID) || (a_streamID > DMA_STREAM7_ID))
+    {
+        LOC_errorStatus = DMA_STREAM_ID_ERROR;
+    }
+
+    else if(a_ptr2remainingData == NULL_PTR)
+    {
+        LOC_errorStatus = DMA_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* The NDTR register is decremented by hardware after each transferred data item. */
+        *a_ptr2remainingData = (uint16)((*(LOC_ptr2DMAx + a_controllerID))->S[a_streamID].NDTR);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_setCallBackFunction
+ * [Description]   : Set the address of the call-back function for a specific DMA stream.
+ * [Arguments]     : <a_controllerID>          -> Indicates to the required DMA controller.
+ *                   <a_streamID>              -> Indicates to the required stream.
+ *                   <a_ptr2callBackFunction>  -> Pointer to the call-back function [takes the interrupt event].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Controller ID Error.
+ *                                                          - Stream ID Error.
+ ====================================================================================================================*/
+DMA_errorStatusType DMA_setCallBackFunction(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID, void (*a_ptr2callBackFunction)(DMA_interruptType))
+{
+    DMA_errorStatusType LOC_errorStatus = DMA_NO_ERRORS;
+
+    if((a_controllerID != DMA1_ID) && (a_controllerID != DMA2_ID))
+    {
+        LOC_errorStatus = DMA_CONTROLLER_ID_ERROR;
+    }
+
+    else if((a_streamID < DMA_STREAM0_ID) || (a_streamID > DMA_STREAM7_ID))
+    {
+        LOC_errorStatus = DMA_STREAM_ID_ERROR;
+    }
+
+    else if(a_ptr2callBackFunction == NULL_PTR)
+    {
+        LOC_errorStatus = DMA_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* Store the address of the call-back function in the global array. */
+        G_callBackFunctionsArray[a_controllerID][a_streamID] = a_ptr2callBackFunction;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA_handleInterrupt
+ * [Description]   : Clear the flags of a specific stream and call its call-back function for each enabled event.
+ * [Arguments]     : <a_controllerID>        -> Indicates to the required DMA controller.
+ *                   <a_streamID>            -> Indicates to the required stream.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void DMA_handleInterrupt(DMA_controllerIDType a_controllerID, DMA_streamIDType a_streamID)
+{
+    DMAx_registersType* LOC_ptr2DMAx[DMA_NUMBER_OF_CONTROLLERS] = {DMA1,DMA2};
+    uint32 LOC_registerIndex = DMA_GET_FLAGS_REGISTER(a_streamID);
+    uint32 LOC_flagsOffset = DMA_GET_FLAGS_OFFSET(a_streamID);
+    uint32 LOC_streamFlags = (((*(LOC_ptr2DMAx + a_controllerID))->ISR[LOC_registerIndex] >> LOC_flagsOffset) & DMA_STREAM_FLAGS_MASK);
+
+    /* Clear the flags that have been read only, so an event raised after the read is not lost. */
+    (*(LOC_ptr2DMAx + a_controllerID))->IFCR[LOC_registerIndex] = (LOC_streamFlags << LOC_flagsOffset);
+
+    /* Each event flag [TEIF - HTIF - TCIF] is one bit above its interrupt enable bit [TEIE - HTIE - TCIE]. */
+    LOC_streamFlags = ((LOC_streamFlags >> 1) & (*(LOC_ptr2DMAx + a_controllerID))->S[a_streamID].CR & DMA_SxCR_INTERRUPTS_MASK);
+
+    if(G_callBackFunctionsArray[a_controllerID][a_streamID] != NULL_PTR)
+    {
+        if(LOC_streamFlags & DMA_TRANSFER_ERROR_INTERRUPT) G_callBackFunctionsArray[a_controllerID][a_streamID](DMA_TRANSFER_ERROR_INTERRUPT);
+        if(LOC_streamFlags & DMA_HALF_TRANSFER_INTERRUPT) G_callBackFunctionsArray[a_controllerID][a_streamID](DMA_HALF_TRANSFER_INTERRUPT);
+        if(LOC_streamFlags & DMA_TRANSFER_COMPLETE_INTERRUPT) G_callBackFunctionsArray[a_controllerID][a_streamID](DMA_TRANSFER_COMPLETE_INTERRUPT);
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA1_StreamX_IRQHandler
+ * [Description]   : The interrupt service routines for DMA1 streams.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DMA1_Stream0_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM0_ID); DWT_ISR_EXIT();}
+void DMA1_Stream1_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM1_ID); DWT_ISR_EXIT();}
+void DMA1_Stream2_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM2_ID); DWT_ISR_EXIT();}
+void DMA1_Stream3_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM3_ID); DWT_ISR_EXIT();}
+void DMA1_Stream4_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM4_ID); DWT_ISR_EXIT();}
+void DMA1_Stream5_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM5_ID); DWT_ISR_EXIT();}
+void DMA1_Stream6_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM6_ID); DWT_ISR_EXIT();}
+void DMA1_Stream7_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA1_ID,DMA_STREAM7_ID); DWT_ISR_EXIT();}
+
+/*=====================================================================================================================
+ * [Function Name] : DMA2_StreamX_IRQHandler
+ * [Description]   : The interrupt service routines for DMA2 streams.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DMA2_Stream0_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM0_ID); DWT_ISR_EXIT();}
+void DMA2_Stream1_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM1_ID); DWT_ISR_EXIT();}
+void DMA2_Stream2_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM2_ID); DWT_ISR_EXIT();}
+void DMA2_Stream3_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM3_ID); DWT_ISR_EXIT();}
+void DMA2_Stream4_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM4_ID); DWT_ISR_EXIT();}
+void DMA2_Stream5_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM5_ID); DWT_ISR_EXIT();}
+void DMA2_Stream6_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM6_ID); DWT_ISR_EXIT();}
+void DMA2_Stream7_IRQHandler(void) {DWT_ISR_ENTER(); DMA_handleInterrupt(DMA2_ID,DMA_STREAM7_ID); DWT_ISR_EXIT();}
@@ -0,0 +1,206 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DWT
+File Name    : dwt.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the ARM Cortex-M4 DWT peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_DWT_INCLUDES_DWT_H_
+#define MCAL_DWT_INCLUDES_DWT_H_
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+/* The probes macros of the other drivers are selected according to the profiling configurations. */
+#include "dwt_cfg.h"
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+#define DWT_PROFILING_DISABLED               (0U)
+#define DWT_PROFILING_ENABLED                (1U)
+
+/* The exception number of SysTick, the exception number of an interrupt request is its IRQ number + 16. */
+#define DWT_SYSTICK_EXCEPTION_NUMBER         (15U)
+
+/* The latency of a handler whose request time is not known by its driver, it is not recorded. */
+#define DWT_UNKNOWN_LATENCY                  (0XFFFFFFFFUL)
+
+/*=====================================================================================================================
+                                       < User-defined Data Types >
+=====================================================================================================================*/
+
+typedef enum
+{
+    DWT_NO_ERRORS,                  /* All Good.                   */
+    DWT_NULL_PTR_ERROR,             /* Null Pointer Error.         */
+    DWT_PROBE_ID_ERROR,             /* Wrong Probe ID Error.       */
+    DWT_EXCEPTION_NUMBER_ERROR,     /* Wrong Exception Number.     */
+    DWT_UART_ERROR,                 /* UART Transmission Error.    */
+}DWT_errorStatusType;
+
+typedef struct
+{
+    uint32 count;                                        /* The number of the recorded measurements.    */
+    uint32 minimum;                                      /* The minimum duration in cycles.             */
+    uint32 maximum;                                      /* The maximum duration in cycles.             */
+    uint32 mean;                                         /* The mean duration in cycles.                */
+    uint64 total;                                        /* The total duration of all the measurements. */
+    uint32 histogram[DWT_HISTOGRAM_NUMBER_OF_BINS];      /* The durations histogram [logarithmic bins]. */
+}DWT_probeStatisticsType;
+
+typedef struct
+{
+    uint32 count;                   /* The number of the handler executions.                          */
+    uint32 latencyCount;            /* The number of the executions with a known latency [0: N/A].    */
+    uint32 maxLatency;              /* The worst latency from the request to the handler in cycles.   */
+    uint32 maxExecutionTime;        /* The worst execution time without the nested handlers.          */
+    uint32 preemptions;             /* The number of times the handler was preempted.                 */
+    uint8 maxNestingLevel;          /* The deepest nesting level the handler ran at [1: Not nested].  */
+}DWT_isrStatisticsType;
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+#if(DWT_PROFILING_STATUS == DWT_PROFILING_ENABLED)
+/* Start a probe measurement in the current scope, it must be ended by DWT_END_PROBE in the same scope. */
+#define DWT_BEGIN_PROBE(PROBE_ID)     uint32 LOC_probe##PROBE_ID##StartCycles = DWT_getCycleCount()
+
+/* End a probe measurement and record its duration in the probe statistics. */
+#define DWT_END_PROBE(PROBE_ID)       DWT_recordProbe((PROBE_ID),(DWT_getCycleCount() - LOC_probe##PROBE_ID##StartCycles))
+#else
+#define DWT_BEGIN_PROBE(PROBE_ID)
+#define DWT_END_PROBE(PROBE_ID)
+#endif
+
+#if(DWT_ISR_INSTRUMENTATION_STATUS == DWT_PROFILING_ENABLED)
+/* Record the entry of the active interrupt handler, it must be the first statement of the handler. */
+#define DWT_ISR_ENTER()                       DWT_enterIsr(DWT_UNKNOWN_LATENCY)
+
+/* Record the entry of the active interrupt handler with a latency in cycles known by its driver. */
+#define DWT_ISR_ENTER_WITH_LATENCY(LATENCY)   DWT_enterIsr(LATENCY)
+
+/* Record the exit of the active interrupt handler, it must be the last statement of the handler. */
+#define DWT_ISR_EXIT()                        DWT_exitIsr()
+#else
+#define DWT_ISR_ENTER()
+#define DWT_ISR_ENTER_WITH_LATENCY(LATENCY)
+#define DWT_ISR_EXIT()
+#endif
+
+/* Get the exception number of a specific interrupt request [NVIC_interruptRequestType]. */
+#define DWT_GET_IRQ_EXCEPTION_NUMBER(IRQ)     ((uint8)((IRQ) + 16U))
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_enableCycleCounter
+ * [Description]   : Enable the trace unit and start the free-running CPU cycle counter.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_enableCycleCounter(void);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_getCycleCount
+ * [Description]   : Get the current value of the CPU cycle counter, the difference between two readings is valid
+ *                   across the counter wrap-around when calculated in unsigned 32-bit arithmetic.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the current cycle count.
+ ====================================================================================================================*/
+uint32 DWT_getCycleCount(void);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_initProfiling
+ * [Description]   : Enable the cycle counter, reset all the probes and interrupts statistics and measure the cycles
+ *                   of an empty probe, which are subtracted from every recorded measurement.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_initProfiling(void);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_recordProbe
+ * [Description]   : Record a measured duration in the statistics of a specific probe [used by DWT_END_PROBE].
+ * [Arguments]     : <a_probeID>           -> Indicates to the ID of the required probe.
+ *                   <a_cycles>            -> Indicates to the measured duration in cycles.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Probe ID Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_recordProbe(uint8 a_probeID, uint32 a_cycles);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_getProbeStatistics
+ * [Description]   : Get a consistent copy of the statistics of a specific probe.
+ * [Arguments]     : <a_probeID>           -> Indicates to the ID of the required probe.
+ *                   <a_ptr2statistics>    -> Pointer to a structure to store the probe statistics.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Probe ID Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_getProbeStatistics(uint8 a_probeID, DWT_probeStatisticsType* a_ptr2statistics);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_resetProbe
+ * [Description]   : Clear the statistics of a specific probe.
+ * [Arguments]     : <a_probeID>           -> Indicates to the ID of the required probe.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Probe ID Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_resetProbe(uint8 a_probeID);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_dumpProbes
+ * [Description]   : Send the statistics of all the used probes as text lines over a specific initialized UART.
+ * [Arguments]     : <a_peripheralIndex>   -> Indicates to the required UART peripheral [UART1_ID - UART2_ID ...].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - UART Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_dumpProbes(uint8 a_peripheralIndex);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_enterIsr
+ * [Description]   : Record the entry of the active interrupt handler and the handler it preempted [used by the
+ *                   DWT_ISR_ENTER macros].
+ * [Arguments]     : <a_latency>           -> Indicates to the latency of the handler in cycles [DWT_UNKNOWN_LATENCY].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_enterIsr(uint32 a_latency);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_exitIsr
+ * [Description]   : Record the exit of the active interrupt handler and its execution time [used by DWT_ISR_EXIT].
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_exitIsr(void);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_getIsrStatistics
+ * [Description]   : Get a consistent copy of the statistics of a specific interrupt handler.
+ * [Arguments]     : <a_exceptionNumber>   -> Indicates to the exception number of the handler [IRQ number + 16].
+ *                   <a_ptr2statistics>    -> Pointer to a structure to store the handler statistics.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Exception Number Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_getIsrStatistics(uint8 a_exceptionNumber, DWT_isrStatisticsType* a_ptr2statistics);
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_resetIsrStatistics
+ * [Description]   : Clear the statistics of all the interrupt handlers.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_resetIsrStatistics(void);
+
+#endif /* MCAL_DWT_INCLUDES_DWT_H_ */
@@ -0,0 +1,45 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DWT
+File Name    : dwt_cfg.h
+Date Created : Oct 17, 2026
+Description  : Configuration file for the ARM Cortex-M4 DWT peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_DWT_INCLUDES_DWT_CFG_H_
+#define MCAL_DWT_INCLUDES_DWT_CFG_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+Set the profiling probes status with one of these options: 1- DWT_PROFILING_ENABLED
+                                                           2- DWT_PROFILING_DISABLED
+When the profiling is disabled, the probes macros are expanded to nothing and the drivers probes cost no cycles.
+=====================================================================================================================*/
+#define DWT_PROFILING_STATUS                 (DWT_PROFILING_DISABLED)
+
+/* Set the number of the profiling probes, the first IDs are used by the drivers and the rest by the application. */
+#define DWT_NUMBER_OF_PROBES                 (8U)
+
+/* Set the number of the histogram bins of each probe, the bin [n] counts the durations in [2^n ~ 2^(n+1) - 1]. */
+#define DWT_HISTOGRAM_NUMBER_OF_BINS         (16U)
+
+/*=====================================================================================================================
+Set the interrupts instrumentation status with one of these options: 1- DWT_PROFILING_ENABLED
+                                                                     2- DWT_PROFILING_DISABLED
+When it is enabled, every driver interrupt handler records its execution time, nesting and preemption, and its
+latency where the request time is known [SysTick - PendSV], and DWT_initProfiling must be called before enabling
+the interrupts.
+=====================================================================================================================*/
+#define DWT_ISR_INSTRUMENTATION_STATUS       (DWT_PROFILING_DISABLED)
+
+/* The IDs of the probes used by the drivers. */
+#define DWT_UART_SEND_BYTE_PROBE             (0U)
+#define DWT_GPIO_WRITE_PIN_PROBE             (1U)
+
+#endif /* MCAL_DWT_INCLUDES_DWT_CFG_H_ */
@@ -0,0 +1,71 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DWT
+File Name    : dwt_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the ARM Cortex-M4 DWT peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_DWT_INCLUDES_DWT_PRV_H_
+#define MCAL_DWT_INCLUDES_DWT_PRV_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+#define DWT_MAX_DECIMAL_DIGITS               (20U)            /* The maximum decimal digits of a uint64 number. */
+#define DWT_MOST_SIGNIFICANT_BIT             (31U)            /* The most significant bit of a uint32 number.   */
+#define DWT_NUMBER_OF_DUMP_FIELDS            (5U)             /* The dumped fields [ID count min max mean].     */
+#define DWT_NUMBER_OF_EXCEPTIONS             (101U)           /* The system exceptions and the 85 IRQs.         */
+#define DWT_MAX_ISR_NESTING_LEVEL            (16U)            /* The maximum nesting of the 16 priority groups. */
+
+/*=====================================================================================================================
+                                       < User-defined Data Types >
+=====================================================================================================================*/
+
+typedef struct
+{
+    uint8 exceptionNumber;     /* The exception number of the active interrupt handler.           */
+    uint32 entryCycles;        /* The cycle count at the handler entry.                           */
+    uint32 nestedCycles;       /* The cycles spent in the nested handlers that preempted it.      */
+}DWT_isrFrameType;
+
+typedef struct
+{
+    volatile uint32 CTRL;      /* DWT Control Register.                    */
+    volatile uint32 CYCCNT;    /* DWT Cycle Count Register.                */
+    volatile uint32 CPICNT;    /* DWT CPI Count Register.                  */
+    volatile uint32 EXCCNT;    /* DWT Exception Overhead Count Register.   */
+    volatile uint32 SLEEPCNT;  /* DWT Sleep Count Register.                */
+    volatile uint32 LSUCNT;    /* DWT LSU Count Register.                  */
+    volatile uint32 FOLDCNT;   /* DWT Folded-instruction Count Register.   */
+    volatile uint32 PCSR;      /* DWT Program Counter Sample Register.     */
+}DWT_registersType;
+
+/*=====================================================================================================================
+                                < Peripheral Registers and Bits Definitions >
+=====================================================================================================================*/
+
+/* The Data Watchpoint and Trace (DWT) unit registers base address. */
+#define DWT                    ((volatile DWT_registersType*)0XE0001000)
+
+/* The Debug Exception and Monitor Control Register, its TRCENA bit powers the DWT unit. */
+#define DWT_DEMCR              (*((volatile uint32*)0XE000EDFC))
+
+#define DWT_CTRL_CYCCNTENA_BIT                      (0UL)      /* Cycle Counter Enable bit number.          */
+#define DWT_DEMCR_TRCENA_BIT                        (24UL)     /* Trace Enable bit number.                  */
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the index of the most significant set bit of a non-zero duration, which is its logarithmic histogram bin. */
+#define DWT_GET_HISTOGRAM_BIN(CYCLES)        (DWT_MOST_SIGNIFICANT_BIT - (uint32)__builtin_clz((unsigned int)(CYCLES)))
+
+/* Read the exception number of the active handler from the IPSR register [IRQ number + 16]. */
+#define DWT_GET_ACTIVE_EXCEPTION(NUMBER)     __asm volatile ("MRS %0, IPSR" : "=r" (NUMBER))
+
+#endif /* MCAL_DWT_INCLUDES_DWT_PRV_H_ */
@@ -0,0 +1,438 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : DWT
+File Name    : dwt.c
+Date Created : Oct 17, 2026
+Description  : Source file for the ARM Cortex-M4 DWT peripheral driver.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../../OTHERS/std_types.h"
+#include "../../../OTHERS/common_macros.h"
+#include "../INCLUDES/dwt_prv.h"
+#include "../INCLUDES/dwt_cfg.h"
+#include "../INCLUDES/dwt.h"
+#include "../../UART/INCLUDES/uart.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+static DWT_probeStatisticsType G_probesStatistics[DWT_NUMBER_OF_PROBES];   /* The statistics of all the probes.  */
+static uint32 G_probeOverheadCycles = 0;                                   /* The cycles of an empty probe.      */
+static DWT_isrStatisticsType G_isrStatistics[DWT_NUMBER_OF_EXCEPTIONS];    /* The statistics of all the handlers. */
+static DWT_isrFrameType G_isrFrames[DWT_MAX_ISR_NESTING_LEVEL];            /* The stack of the active handlers.   */
+static uint8 G_isrNestingLevel = 0;                                        /* The number of the active handlers.  */
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_enableCycleCounter
+ * [Description]   : Enable the trace unit and start the free-running CPU cycle counter.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_enableCycleCounter(void)
+{
+    /* The counter keeps running if it is already enabled, so the running measurements are not corrupted. */
+    if(BIT_IS_CLEAR(DWT->CTRL,DWT_CTRL_CYCCNTENA_BIT))
+    {
+        SET_BIT(DWT_DEMCR,DWT_DEMCR_TRCENA_BIT);                         /* Enable the trace unit.    */
+        DWT->CYCCNT = 0;                                                 /* Reset the cycle counter.  */
+        SET_BIT(DWT->CTRL,DWT_CTRL_CYCCNTENA_BIT);                       /* Enable the cycle counter. */
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_getCycleCount
+ * [Description]   : Get the current value of the CPU cycle counter, the difference between two readings is valid
+ *                   across the counter wrap-around when calculated in unsigned 32-bit arithmetic.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the current cycle count.
+ ====================================================================================================================*/
+uint32 DWT_getCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_initProfiling
+ * [Description]   : Enable the cycle counter, reset all the probes statistics and measure the cycles of an empty
+ *                   probe, which are subtracted from every recorded measurement.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_initProfiling(void)
+{
+    uint32 LOC_startCycles = 0;
+
+    DWT_enableCycleCounter();
+
+    for(uint8 LOC_probeID = 0; LOC_probeID < DWT_NUMBER_OF_PROBES; LOC_probeID++)
+    {
+        DWT_resetProbe(LOC_probeID);
+    }
+
+    DWT_resetIsrStatistics();
+
+    /* Measure an empty probe, it is the cost of reading the counter twice. */
+    G_probeOverheadCycles = 0;
+    LOC_startCycles = DWT_getCycleCount();
+    G_probeOverheadCycles = (DWT_getCycleCount() - LOC_startCycles);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_recordProbe
+ * [Description]   : Record a measured duration in the statistics of a specific probe [used by DWT_END_PROBE].
+ * [Arguments]     : <a_probeID>           -> Indicates to the ID of the required probe.
+ *                   <a_cycles>            -> Indicates to the measured duration in cycles.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Probe ID Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_recordProbe(uint8 a_probeID, uint32 a_cycles)
+{
+    DWT_errorStatusType LOC_errorStatus = DWT_NO_ERRORS;
+    DWT_probeStatisticsType* LOC_ptr2statistics = NULL_PTR;
+    uint32 LOC_interruptsState = 0;
+    uint32 LOC_bin = 0;
+
+    if(a_probeID >= DWT_NUMBER_OF_PROBES)
+    {
+        LOC_errorStatus = DWT_PROBE_ID_ERROR;
+    }
+
+    else
+    {
+        LOC_ptr2statistics = (G_probesStatistics + a_probeID);
+
+        /* Remove the cycles of the probe itself, then find the logarithmic histogram bin of the duration. */
+        a_cycles = ((a_cycles > G_probeOverheadCycles) ? (a_cycles - G_probeOverheadCycles) : 0);
+        LOC_bin = ((a_cycles == 0) ? 0 : DWT_GET_HISTOGRAM_BIN(a_cycles));
+        LOC_bin = ((LOC_bin < DWT_HISTOGRAM_NUMBER_OF_BINS) ? LOC_bin : (DWT_HISTOGRAM_NUMBER_OF_BINS - 1U));
+
+        /* The probes may be recorded from the interrupts, so the statistics are updated together. */
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        if((LOC_ptr2statistics->count == 0) || (a_cycles < LOC_ptr2statistics->minimum))
+        {
+            LOC_ptr2statistics->minimum = a_cycles;
+        }
+        if(a_cycles > LOC_ptr2statistics->maximum)
+        {
+            LOC_ptr2statistics->maximum = a_cycles;
+        }
+        LOC_ptr2statistics->count++;
+        LOC_ptr2statistics->total += a_cycles;
+        (*(LOC_ptr2statistics->histogram + LOC_bin))++;
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_getProbeStatistics
+ * [Description]   : Get a consistent copy of the statistics of a specific probe.
+ * [Arguments]     : <a_probeID>           -> Indicates to the ID of the required probe.
+ *                   <a_ptr2statistics>    -> Pointer to a structure to store the probe statistics.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Probe ID Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_getProbeStatistics(uint8 a_probeID, DWT_probeStatisticsType* a_ptr2statistics)
+{
+    DWT_errorStatusType LOC_errorStatus = DWT_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if(a_ptr2statistics == NULL_PTR)
+    {
+        LOC_errorStatus = DWT_NULL_PTR_ERROR;
+    }
+
+    else if(a_probeID >= DWT_NUMBER_OF_PROBES)
+    {
+        LOC_errorStatus = DWT_PROBE_ID_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        *a_ptr2statistics = *(G_probesStatistics + a_probeID);
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+
+        /* The mean is calculated on reading, so the recording path has no division. */
+        a_ptr2statistics->mean = ((a_ptr2statistics->count == 0) ? 0 : (uint32)(a_ptr2statistics->total / a_ptr2statistics->count));
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_resetProbe
+ * [Description]   : Clear the statistics of a specific probe.
+ * [Arguments]     : <a_probeID>           -> Indicates to the ID of the required probe.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Probe ID Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_resetProbe(uint8 a_probeID)
+{
+    DWT_errorStatusType LOC_errorStatus = DWT_NO_ERRORS;
+    DWT_probeStatisticsType* LOC_ptr2statistics = NULL_PTR;
+    uint32 LOC_interruptsState = 0;
+
+    if(a_probeID >= DWT_NUMBER_OF_PROBES)
+    {
+        LOC_errorStatus = DWT_PROBE_ID_ERROR;
+    }
+
+    else
+    {
+        LOC_ptr2statistics = (G_probesStatistics + a_probeID);
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        LOC_ptr2statistics->count = 0;
+        LOC_ptr2statistics->minimum = 0;
+        LOC_ptr2statistics->maximum = 0;
+        LOC_ptr2statistics->mean = 0;
+        LOC_ptr2statistics->total = 0;
+        for(uint8 LOC_bin = 0; LOC_bin < DWT_HISTOGRAM_NUMBER_OF_BINS; LOC_bin++)
+        {
+            *(LOC_ptr2statistics->histogram + LOC_bin) = 0;
+        }
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_sendNumber
+ * [Description]   : Send a specific number as decimal text followed by a specific separator character.
+ * [Arguments]     : <a_peripheralIndex>   -> Indicates to the required UART peripheral.
+ *                   <a_number>            -> Indicates to the required number to be sent.
+ *                   <a_separator>         -> Indicates to the character sent after the number.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - UART Error.
+ ====================================================================================================================*/
+static DWT_errorStatusType DWT_sendNumber(uint8 a_peripheralIndex, uint64 a_number, uint8 a_separator)
+{
+    DWT_errorStatusType LOC_errorStatus = DWT_NO_ERRORS;
+    uint8 LOC_digits[DWT_MAX_DECIMAL_DIGITS];
+    uint8 LOC_numberOfDigits = 0;
+
+    /* Convert the number into digits from the least significant, then send them in the reverse order. */
+    do
+    {
+        *(LOC_digits + LOC_numberOfDigits++) = (uint8)('0' + (a_number % 10U));
+        a_number /= 10U;
+    }while(a_number != 0);
+
+    while((LOC_numberOfDigits != 0) && (LOC_errorStatus == DWT_NO_ERRORS))
+    {
+        LOC_numberOfDigits--;
+        if(UART_sendByte((UART_peripheralIndexType)a_peripheralIndex,*(LOC_digits + LOC_numberOfDigits)) != UART_NO_ERRORS)
+        {
+            LOC_errorStatus = DWT_UART_ERROR;
+        }
+    }
+
+    if((LOC_errorStatus == DWT_NO_ERRORS) && (UART_sendByte((UART_peripheralIndexType)a_peripheralIndex,a_separator) != UART_NO_ERRORS))
+    {
+        LOC_errorStatus = DWT_UART_ERROR;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_dumpProbes
+ * [Description]   : Send the statistics of all the used probes as text lines over a specific initialized UART, each
+ *                   line is [ID count minimum maximum mean : histogram bins] in cycles.
+ * [Arguments]     : <a_peripheralIndex>   -> Indicates to the required UART peripheral [UART1_ID - UART2_ID ...].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - UART Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_dumpProbes(uint8 a_peripheralIndex)
+{
+    DWT_errorStatusType LOC_errorStatus = DWT_NO_ERRORS;
+    DWT_probeStatisticsType LOC_statistics;
+
+    for(uint8 LOC_probeID = 0; (LOC_probeID < DWT_NUMBER_OF_PROBES) && (LOC_errorStatus == DWT_NO_ERRORS); LOC_probeID++)
+    {
+        /* Take a copy first, the dump itself may be recorded by the UART probe. */
+        DWT_getProbeStatistics(LOC_probeID,&LOC_statistics);
+
+        if(LOC_statistics.count != 0)
+        {
+            uint64 LOC_fields[DWT_NUMBER_OF_DUMP_FIELDS] = {LOC_probeID,LOC_statistics.count,LOC_statistics.minimum,
+                                                            LOC_statistics.maximum,LOC_statistics.mean};
+
+            for(uint8 LOC_field = 0; (LOC_field < DWT_NUMBER_OF_DUMP_FIELDS) && (LOC_errorStatus == DWT_NO_ERRORS); LOC_field++)
+            {
+                LOC_errorStatus = DWT_sendNumber(a_peripheralIndex,*(LOC_fields + LOC_field),
+                                                 ((LOC_field == (DWT_NUMBER_OF_DUMP_FIELDS - 1U)) ? ':' : ' '));
+            }
+
+            for(uint8 LOC_bin = 0; (LOC_bin < DWT_HISTOGRAM_NUMBER_OF_BINS) && (LOC_errorStatus == DWT_NO_ERRORS); LOC_bin++)
+            {
+                LOC_errorStatus = DWT_sendNumber(a_peripheralIndex,*(LOC_statistics.histogram + LOC_bin),
+                                                 ((LOC_bin == (DWT_HISTOGRAM_NUMBER_OF_BINS - 1U)) ? '\n' : ' '));
+            }
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_enterIsr
+ * [Description]   : Record the entry of the active interrupt handler and the handler it preempted [used by the
+ *                   DWT_ISR_ENTER macros].
+ * [Arguments]     : <a_latency>           -> Indicates to the latency of the handler in cycles [DWT_UNKNOWN_LATENCY].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_enterIsr(uint32 a_latency)
+{
+    uint32 LOC_exceptionNumber = 0;
+    uint32 LOC_interruptsState = 0;
+    DWT_isrStatisticsType* LOC_ptr2statistics = NULL_PTR;
+
+    DWT_GET_ACTIVE_EXCEPTION(LOC_exceptionNumber);
+    LOC_ptr2statistics = (G_isrStatistics + (LOC_exceptionNumber % DWT_NUMBER_OF_EXCEPTIONS));
+
+    /* A higher priority handler may preempt this one between the updates, so they are done together. */
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    if((G_isrNestingLevel != 0) && (G_isrNestingLevel <= DWT_MAX_ISR_NESTING_LEVEL))
+    {
+        /* The handler on the top of the stack is preempted by this one. */
+        (G_isrStatistics + (G_isrFrames + (G_isrNestingLevel - 1U))->exceptionNumber)->preemptions++;
+    }
+
+    if(G_isrNestingLevel < DWT_MAX_ISR_NESTING_LEVEL)
+    {
+        (G_isrFrames + G_isrNestingLevel)->exceptionNumber = (uint8)LOC_exceptionNumber;
+        (G_isrFrames + G_isrNestingLevel)->nestedCycles = 0;
+        (G_isrFrames + G_isrNestingLevel)->entryCycles = DWT_getCycleCount();
+    }
+
+    G_isrNestingLevel++;
+    LOC_ptr2statistics->count++;
+    if(a_latency != DWT_UNKNOWN_LATENCY)
+    {
+        LOC_ptr2statistics->latencyCount++;
+        if(a_latency > LOC_ptr2statistics->maxLatency)
+        {
+            LOC_ptr2statistics->maxLatency = a_latency;
+        }
+    }
+    if(G_isrNestingLevel > LOC_ptr2statistics->maxNestingLevel)
+    {
+        LOC_ptr2statistics->maxNestingLevel = G_isrNestingLevel;
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_exitIsr
+ * [Description]   : Record the exit of the active interrupt handler and its execution time [used by DWT_ISR_EXIT].
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_exitIsr(void)
+{
+    uint32 LOC_interruptsState = 0;
+    uint32 LOC_totalCycles = 0;
+    uint32 LOC_executionTime = 0;
+    DWT_isrFrameType* LOC_ptr2frame = NULL_PTR;
+    DWT_isrStatisticsType* LOC_ptr2statistics = NULL_PTR;
+
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    if((G_isrNestingLevel != 0) && (G_isrNestingLevel <= DWT_MAX_ISR_NESTING_LEVEL))
+    {
+        LOC_ptr2frame = (G_isrFrames + (G_isrNestingLevel - 1U));
+        LOC_ptr2statistics = (G_isrStatistics + LOC_ptr2frame->exceptionNumber);
+
+        /* The execution time of the handler excludes the time of the handlers that preempted it. */
+        LOC_totalCycles = (DWT_getCycleCount() - LOC_ptr2frame->entryCycles);
+        LOC_executionTime = (LOC_totalCycles - LOC_ptr2frame->nestedCycles);
+        if(LOC_executionTime > LOC_ptr2statistics->maxExecutionTime)
+        {
+            LOC_ptr2statistics->maxExecutionTime = LOC_executionTime;
+        }
+
+        /* The whole time of this handler is a nested time for the handler it preempted. */
+        if(G_isrNestingLevel > 1U)
+        {
+            (LOC_ptr2frame - 1)->nestedCycles += LOC_totalCycles;
+        }
+    }
+
+    if(G_isrNestingLevel != 0)
+    {
+        G_isrNestingLevel--;
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_getIsrStatistics
+ * [Description]   : Get a consistent copy of the statistics of a specific interrupt handler.
+ * [Arguments]     : <a_exceptionNumber>   -> Indicates to the exception number of the handler [IRQ number + 16].
+ *                   <a_ptr2statistics>    -> Pointer to a structure to store the handler statistics.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Exception Number Error.
+ ====================================================================================================================*/
+DWT_errorStatusType DWT_getIsrStatistics(uint8 a_exceptionNumber, DWT_isrStatisticsType* a_ptr2statistics)
+{
+    DWT_errorStatusType LOC_errorStatus = DWT_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if(a_ptr2statistics == NULL_PTR)
+    {
+        LOC_errorStatus = DWT_NULL_PTR_ERROR;
+    }
+
+    else if(a_exceptionNumber >= DWT_NUMBER_OF_EXCEPTIONS)
+    {
+        LOC_errorStatus = DWT_EXCEPTION_NUMBER_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        *a_ptr2statistics = *(G_isrStatistics + a_exceptionNumber);
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : DWT_resetIsrStatistics
+ * [Description]   : Clear the statistics of all the interrupt handlers.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void DWT_resetIsrStatistics(void)
+{
+    uint32 LOC_interruptsState = 0;
+
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    for(uint8 LOC_exceptionNumber = 0; LOC_exceptionNumber < DWT_NUMBER_OF_EXCEPTIONS; LOC_exceptionNumber++)
+    {
+        (G_isrStatistics + LOC_exceptionNumber)->count = 0;
+        (G_isrStatistics + LOC_exceptionNumber)->latencyCount = 0;
+        (G_isrStatistics + LOC_exceptionNumber)->maxLatency = 0;
+        (G_isrStatistics + LOC_exceptionNumber)->maxExecutionTime = 0;
+        (G_isrStatistics + LOC_exceptionNumber)->preemptions = 0;
+        (G_isrStatistics + LOC_exceptionNumber)->maxNestingLevel = 0;
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+}
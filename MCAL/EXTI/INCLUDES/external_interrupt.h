@@ -23,6 +23,7 @@ typedef enum
     EXTI_TRIGGER_MODE_ERROR,    /* Wrong Trigger Mode Error.   */
     EXTI_CHANNEL_INDEX_ERROR,   /* Wrong Channel Index Error.  */
     EXTI_CHANNEL_SOURCE_ERROR,  /* Wrong Channel Source Error. */
+    EXTI_QUEUE_FULL_ERROR,      /* Events Queue Full Error.    */
 }EXTI_errorStatusType;
 
 typedef enum
@@ -63,6 +64,19 @@ typedef enum
     EXTI_CHANNEL_15,            /* External Interrupt Channel 15. */
 }EXTI_channelIndexType;
 
+typedef enum
+{
+    EXTI_FALLING_EDGE,          /* The pin changed from high to low. */
+    EXTI_RISING_EDGE,           /* The pin changed from low to high. */
+}EXTI_edgeType;
+
+typedef struct
+{
+    EXTI_channelIndexType channel;  /* The channel of the event.                                  */
+    EXTI_edgeType edge;             /* The edge of the event.                                     */
+    uint32 timestamp;               /* The CPU cycle count at the entry of the interrupt handler. */
+}EXTI_eventType;
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
@@ -126,4 +140,81 @@ EXTI_errorStatusType EXTI_setTriggerMode(EXTI_channelIndexType a_channelIndex, E
  ====================================================================================================================*/
 EXTI_errorStatusType EXTI_setCallBackFunction(EXTI_channelIndexType a_channelIndex, void (*a_ptr2callBackFunction)(void));
 
+/*=====================================================================================================================
+ * [Function Name] : EXTI_setEventCallBackFunction
+ * [Description]   : Set the address of the event call-back function for a specific External Interrupt channel, it is
+ *                   called instead of the call-back function with the event [edge - timestamp] of the interrupt.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2callBackFunction> -> Pointer to the event call-back function.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_setEventCallBackFunction(EXTI_channelIndexType a_channelIndex, void (*a_ptr2callBackFunction)(EXTI_eventType*));
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getDroppedEvents
+ * [Description]   : Get the number of the events dropped because the deferred events queue was full.
+ * [Arguments]     : <a_ptr2droppedEvents>    -> Pointer to variable to store the number of the dropped events.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getDroppedEvents(uint32* a_ptr2droppedEvents);
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getLastEvent
+ * [Description]   : Get the last event [edge - timestamp] of a specific External Interrupt channel.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2event>            -> Pointer to a structure to store the last event.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getLastEvent(EXTI_channelIndexType a_channelIndex, EXTI_eventType* a_ptr2event);
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getPulseCount
+ * [Description]   : Get the number of the edges detected on a specific External Interrupt channel.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2pulseCount>       -> Pointer to variable to store the number of the edges.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getPulseCount(EXTI_channelIndexType a_channelIndex, uint32* a_ptr2pulseCount);
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_resetPulseCount
+ * [Description]   : Reset the number of the edges and the period measurement of a specific External Interrupt channel.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_resetPulseCount(EXTI_channelIndexType a_channelIndex);
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getPeriod
+ * [Description]   : Get the average period between the edges of a specific channel since the previous call, then start
+ *                   a new averaging window. It must be called at least once every 2^32 CPU cycles while the edges are
+ *                   detected, and with both edges triggering the period is between the successive edges.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2period>           -> Pointer to variable to store the period in CPU cycles [0: No period].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getPeriod(EXTI_channelIndexType a_channelIndex, uint32* a_ptr2period);
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getFrequency
+ * [Description]   : Get the average frequency of the edges of a specific channel since the previous call, it is
+ *                   calculated from EXTI_getPeriod and the current CPU clock.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2frequency>        -> Pointer to variable to store the frequency in millihertz [0: No edges].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getFrequency(EXTI_channelIndexType a_channelIndex, uint32* a_ptr2frequency);
+
 #endif /* MCAL_EXTI_INCLUDES_EXTERNAL_INTERRUPT_H_ */
@@ -85,4 +85,43 @@ Set the trigger mode for every EXTI channel with one of these options: 1- EXTI_F
 #define EXTI_CHANNEL_14_TRIGGER_MODE                              (EXTI_RISING_EDGE_TRIGGER)
 #define EXTI_CHANNEL_15_TRIGGER_MODE                              (EXTI_RISING_EDGE_TRIGGER)
 
+/*=====================================================================================================================
+Set the debounce time of every EXTI channel in milliseconds [0: The channel is not debounced].
+On the first edge of a debounced channel its interrupt is masked, then after the debounce time the level of its source
+pin is checked. If the level still matches the edge, the edge is counted and dispatched with its timestamp, otherwise
+it is dropped as a glitch. The pending flag of the bounces is cleared, then the channel interrupt is unmasked.
+The debounce time is counted by a SysTick software timer with one millisecond accuracy, so the SysTick timebase must be
+running [SYSTICK_startTimebase] and a free software timer must be available when any channel is debounced. If no
+software timer is free at EXTI_init, the debounce is off and the edges of all the channels are dispatched immediately.
+=====================================================================================================================*/
+#define EXTI_CHANNEL_00_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_01_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_02_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_03_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_04_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_05_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_06_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_07_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_08_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_09_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_10_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_11_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_12_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_13_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_14_DEBOUNCE_TIME                             (0U)
+#define EXTI_CHANNEL_15_DEBOUNCE_TIME                             (0U)
+
+/*=====================================================================================================================
+Set the call-back functions dispatch mode with one of these options: 1- EXTI_IMMEDIATE_DISPATCH
+                                                                     2- EXTI_DEFERRED_DISPATCH
+In the deferred mode, the interrupt handlers only queue an event [channel - edge - timestamp] for every pending channel
+that has a call-back function and set PendSV pending, then the PendSV handler of this driver calls the call-back
+functions of the queued events. In both modes the edges of every channel are counted and timed.
+PendSV must be set to the lowest priority by the application, and it must not be used by any other module.
+=====================================================================================================================*/
+#define EXTI_DISPATCH_MODE                                        (EXTI_IMMEDIATE_DISPATCH)
+
+/* Set the size of the deferred events queue [must be a power of two]. */
+#define EXTI_EVENT_QUEUE_SIZE                                     (32U)
+
 #endif /* MCAL_EXTI_INCLUDES_EXTERNAL_INTERRUPT_CFG_H_ */
@@ -12,6 +12,13 @@ Description  : Private file for the STM32F401xx External Interrupt Peripheral dr
 #ifndef MCAL_EXTI_INCLUDES_EXTERNAL_INTERRUPT_PRV_H_
 #define MCAL_EXTI_INCLUDES_EXTERNAL_INTERRUPT_PRV_H_
 
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+/* The addresses of the GPIO ports input data registers read by the channels. */
+#include "../../GPIO/INCLUDES/gpio_addresses.h"
+
 /*=====================================================================================================================
                                 < Definitions and Static Configurations >
 =====================================================================================================================*/
@@ -19,14 +26,53 @@ Description  : Private file for the STM32F401xx External Interrupt Peripheral dr
 /* The number of EXTI channels on the IO pins. */
 #define EXTI_NUMBER_OF_CHANNELS      (16U)
 
+/* The number of the SYSCFG EXTICRx registers, every register holds the sources of four channels. */
+#define EXTI_NUMBER_OF_SOURCE_REGISTERS  (4U)
+
 /* Two macros used in the channel configurations [Disabled - Enabled]. */
 #define EXTI_DISABLED_CHANNEL        (0U)
 #define EXTI_ENABLED_CHANNEL         (1U)
 
+/* The call-back functions dispatch modes [Immediate - Deferred]. */
+#define EXTI_IMMEDIATE_DISPATCH      (0U)
+#define EXTI_DEFERRED_DISPATCH       (1U)
+
+/* The channels of every shared interrupt handler [EXTI5 ~ EXTI9] and [EXTI10 ~ EXTI15]. */
+#define EXTI_CHANNELS_09_05_MASK     (0X03E0UL)
+#define EXTI_CHANNELS_15_10_MASK     (0XFC00UL)
+
+#define EXTI_MIN_WINDOW_EDGES        (2U)         /* The minimum edges to measure a period.  */
+#define EXTI_MILLIHERTZ_IN_HERTZ     (1000ULL)    /* The number of millihertz in one hertz.  */
+#define EXTI_DEBOUNCE_TICK_TIME      (1UL)        /* The debounce timer period in milliseconds. */
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
 
+typedef struct
+{
+    uint32 pulseCount;            /* The number of the detected edges.                         */
+    uint32 lastTimestamp;         /* The timestamp of the last edge.                           */
+    uint32 windowTimestamp;       /* The timestamp of the first edge of the averaging window.  */
+    uint32 windowEdges;           /* The number of the edges in the averaging window.          */
+    uint8 lastEdge;               /* The last edge [Falling - Rising].                         */
+}EXTI_captureType;                /* The edges capture of one channel.                         */
+
+typedef struct
+{
+    uint8 status;                 /* The channel status [Enabled - Disabled].                  */
+    uint8 source;                 /* The source port of the channel [EXTI_channelSourceType].  */
+    uint8 triggerMode;            /* The trigger mode of the channel [EXTI_triggerModeType].   */
+    uint16 debounceTime;          /* The debounce time in milliseconds [0: Not debounced].     */
+}EXTI_channelConfigurationsType;  /* The static configurations of one channel.                 */
+
+typedef struct
+{
+    uint32 timestamp;             /* The timestamp of the first edge.                          */
+    uint16 remainingTime;         /* The remaining debounce time in milliseconds.              */
+    uint8 edge;                   /* The first edge [Falling - Rising].                        */
+}EXTI_debounceType;               /* The debounce state of one channel.                        */
+
 typedef struct
 {
     volatile uint32 IMR;          /* Interrupt mask register.                     */
@@ -57,6 +103,9 @@ typedef struct
 /* SYSCFG peripheral registers base addresss. */
 #define SYSCFG                    ((volatile SYSCFG_registersType*)0X40013800)
 
+/* The input data register of a GPIO port, the ports are indexed by the channel source values [PORTH = 7]. */
+#define EXTI_GPIO_IDR(PORT)       (*((volatile uint32*)(GPIO_PORTA_BASE_ADDRESS + ((uint32)(PORT) * GPIO_PORT_ADDRESS_STEP) + GPIO_IDR_OFFSET)))
+
 /*=====================================================================================================================
                                          < Function-like Macros >
 =====================================================================================================================*/
@@ -64,4 +113,45 @@ typedef struct
 /* Macros used to write on multiple bits for corresponding External Interrupt channel in the SYSCFG registers. */
 #define EXTI_WRITE_FOUR_BITS(REG,CHANNEL,VALUE) (REG = ((REG & (~(0X0F << (CHANNEL * 4)))) | ((VALUE & 0X0F) << (CHANNEL * 4))))
 
+/* Check if any channel is enabled, so the shared handling functions are compiled only when they are used. */
+#define EXTI_ANY_CHANNEL_ENABLED ((EXTI_CHANNEL_00_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_01_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_02_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_03_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_04_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_05_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_06_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_07_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_08_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_09_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_10_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_11_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_12_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_13_STATUS == EXTI_ENABLED_CHANNEL) || \
+                                  (EXTI_CHANNEL_14_STATUS == EXTI_ENABLED_CHANNEL) || (EXTI_CHANNEL_15_STATUS == EXTI_ENABLED_CHANNEL))
+
+/* Check if any enabled channel is debounced, so the debounce timer is created only when it is used. */
+#define EXTI_ANY_CHANNEL_DEBOUNCED (((EXTI_CHANNEL_00_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_00_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_01_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_01_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_02_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_02_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_03_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_03_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_04_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_04_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_05_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_05_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_06_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_06_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_07_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_07_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_08_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_08_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_09_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_09_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_10_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_10_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_11_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_11_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_12_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_12_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_13_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_13_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_14_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_14_DEBOUNCE_TIME != 0)) || \
+                                    ((EXTI_CHANNEL_15_STATUS == EXTI_ENABLED_CHANNEL) && (EXTI_CHANNEL_15_DEBOUNCE_TIME != 0)))
+
+/* Generate the configurations table entry of a specific channel [00 ~ 15] from its static configurations. */
+#define EXTI_CHANNEL_CONFIGURATIONS(CHANNEL) {EXTI_CHANNEL_##CHANNEL##_STATUS,EXTI_CHANNEL_##CHANNEL##_SOURCE,  \
+                                              EXTI_CHANNEL_##CHANNEL##_TRIGGER_MODE,EXTI_CHANNEL_##CHANNEL##_DEBOUNCE_TIME}
+
+/* Get the position of the four source bits of a specific channel in its SYSCFG EXTICRx register. */
+#define EXTI_GET_SOURCE_SHIFT(CHANNEL) (((CHANNEL) % 4U) * 4U)
+
+/* Get the lowest set channel of a channels mask by counting the trailing zeros [RBIT and CLZ on Cortex-M4]. */
+#define EXTI_GET_LOWEST_CHANNEL(MASK) ((uint32)__builtin_ctz(MASK))
+
+/* Get the source port of a specific channel from its four bits in the SYSCFG EXTICRx registers. */
+#define EXTI_GET_CHANNEL_SOURCE(CHANNEL) ((*(&SYSCFG->EXTICR1 + ((CHANNEL) / 4U)) >> EXTI_GET_SOURCE_SHIFT(CHANNEL)) & 0X0FUL)
+
 #endif /* MCAL_EXTI_INCLUDES_EXTERNAL_INTERRUPT_PRV_H_ */
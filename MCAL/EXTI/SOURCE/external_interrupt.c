@@ -15,9 +15,14 @@ Description  : Source file for the STM32F401xx External Interrupt Peripheral dri
 
 #include "../../../OTHERS/std_types.h"
 #include "../../../OTHERS/common_macros.h"
+#include "../../../OTHERS/bit_banding.h"
 #include "../INCLUDES/external_interrupt_prv.h"
 #include "../INCLUDES/external_interrupt_cfg.h"
 #include "../INCLUDES/external_interrupt.h"
+#include "../../DWT/INCLUDES/dwt.h"
+#include "../../SCB/INCLUDES/scb.h"
+#include "../../RCC/INCLUDES/rcc.h"
+#include "../../SYSTICK/INCLUDES/systick.h"
 
 /*=====================================================================================================================
                                            < Global Variables >
@@ -26,6 +31,65 @@ Description  : Source file for the STM32F401xx External Interrupt Peripheral dri
 /* Array of pointers to function stores the addresses of the call-back functions. */
 static void (*G_callBackFunctionsArray[EXTI_NUMBER_OF_CHANNELS])(void) = {NULL_PTR};
 
+/* Array of pointers to function stores the addresses of the event call-back functions. */
+static void (*G_eventCallBackFunctionsArray[EXTI_NUMBER_OF_CHANNELS])(EXTI_eventType*) = {NULL_PTR};
+
+/* The edges captures of all the channels [pulse count - period measurement - last event]. */
+static EXTI_captureType G_channelsCaptures[EXTI_NUMBER_OF_CHANNELS];
+
+/* The static configurations of all the channels, generated from the configurations file. */
+static const EXTI_channelConfigurationsType G_channelsConfigurations[EXTI_NUMBER_OF_CHANNELS] =
+{
+    EXTI_CHANNEL_CONFIGURATIONS(00),
+    EXTI_CHANNEL_CONFIGURATIONS(01),
+    EXTI_CHANNEL_CONFIGURATIONS(02),
+    EXTI_CHANNEL_CONFIGURATIONS(03),
+    EXTI_CHANNEL_CONFIGURATIONS(04),
+    EXTI_CHANNEL_CONFIGURATIONS(05),
+    EXTI_CHANNEL_CONFIGURATIONS(06),
+    EXTI_CHANNEL_CONFIGURATIONS(07),
+    EXTI_CHANNEL_CONFIGURATIONS(08),
+    EXTI_CHANNEL_CONFIGURATIONS(09),
+    EXTI_CHANNEL_CONFIGURATIONS(10),
+    EXTI_CHANNEL_CONFIGURATIONS(11),
+    EXTI_CHANNEL_CONFIGURATIONS(12),
+    EXTI_CHANNEL_CONFIGURATIONS(13),
+    EXTI_CHANNEL_CONFIGURATIONS(14),
+    EXTI_CHANNEL_CONFIGURATIONS(15)
+};
+
+#if(EXTI_ANY_CHANNEL_DEBOUNCED)
+/* The debounce states of all the channels, and the mask of the channels being debounced. */
+static EXTI_debounceType G_channelsDebounces[EXTI_NUMBER_OF_CHANNELS];
+static volatile uint32 G_debouncingChannels = 0;
+
+/* The ID of the SysTick software timer that counts the debounce times, it is used only if the timer is created. */
+static uint16 G_debounceTimerID = 0;
+static uint8 G_debounceTimerCreated = FALSE;
+#endif
+
+/* The number of the events dropped because the deferred events queue was full. */
+static volatile uint32 G_droppedEvents = 0;
+
+#if(EXTI_DISPATCH_MODE == EXTI_DEFERRED_DISPATCH)
+/* The deferred events queue, the handlers reserve the slots at the head and PendSV consumes them at the tail. */
+static EXTI_eventType G_eventQueue[EXTI_EVENT_QUEUE_SIZE];
+static volatile uint8 G_eventQueueReadyFlags[EXTI_EVENT_QUEUE_SIZE] = {FALSE};
+static volatile uint32 G_eventQueueHead = 0;
+static volatile uint32 G_eventQueueTail = 0;
+
+#if(DWT_ISR_INSTRUMENTATION_STATUS == DWT_PROFILING_ENABLED)
+/* The cycle count of the first PendSV request since its last run, the latency of the dispatcher is measured from it. */
+static volatile uint32 G_dispatchRequestCycles = 0;
+static volatile uint8 G_dispatchRequested = FALSE;
+#endif
+#endif
+
+#if(EXTI_ANY_CHANNEL_DEBOUNCED)
+/* The debounce timer call-back function is defined with the interrupts handling functions. */
+static void EXTI_confirmDebounces(void);
+#endif
+
 /*=====================================================================================================================
                                           < Functions Definitions >
 =====================================================================================================================*/
@@ -38,117 +102,58 @@ static void (*G_callBackFunctionsArray[EXTI_NUMBER_OF_CHANNELS])(void) = {NULL_P
  ====================================================================================================================*/
 void EXTI_init(void)
 {
-    /* If EXTI0 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_00_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_00,EXTI_CHANNEL_00_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_00,EXTI_CHANNEL_00_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_00);                                /* Enable EXTI0 channel interrupt. */
-    #endif
-    
-    /* If EXTI1 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_01_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_01,EXTI_CHANNEL_01_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_01,EXTI_CHANNEL_01_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_01);                                /* Enable EXTI1 channel interrupt. */
-    #endif
-    
-    /* If EXTI2 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_02_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_02,EXTI_CHANNEL_02_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_02,EXTI_CHANNEL_02_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_02);                                /* Enable EXTI2 channel interrupt. */
-    #endif
-    
-    /* If EXTI3 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_03_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_03,EXTI_CHANNEL_03_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_03,EXTI_CHANNEL_03_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_03);                                /* Enable EXTI3 channel interrupt. */
-    #endif
-    
-    /* If EXTI4 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_04_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_04,EXTI_CHANNEL_04_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_04,EXTI_CHANNEL_04_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_04);                                /* Enable EXTI4 channel interrupt. */
-    #endif
-    
-    /* If EXTI5 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_05_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_05,EXTI_CHANNEL_05_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_05,EXTI_CHANNEL_05_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_05);                                /* Enable EXTI5 channel interrupt. */
-    #endif
-    
-    /* If EXTI6 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_06_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_06,EXTI_CHANNEL_06_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_06,EXTI_CHANNEL_06_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_06);                                /* Enable EXTI6 channel interrupt. */
-    #endif
-    
-    /* If EXTI7 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_07_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_07,EXTI_CHANNEL_07_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_07,EXTI_CHANNEL_07_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_07);                                /* Enable EXTI7 channel interrupt. */
-    #endif
-    
-    /* If EXTI8 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_08_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_08,EXTI_CHANNEL_08_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_08,EXTI_CHANNEL_08_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_08);                                /* Enable EXTI8 channel interrupt. */
-    #endif
-    
-    /* If EXTI9 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_09_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_09,EXTI_CHANNEL_09_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_09,EXTI_CHANNEL_09_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_09);                                /* Enable EXTI9 channel interrupt. */
-    #endif
-    
-    /* If EXTI10 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_10_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_10,EXTI_CHANNEL_10_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_10,EXTI_CHANNEL_10_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_10);                               /* Enable EXTI10 channel interrupt. */
-    #endif
-    
-    /* If EXTI11 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_11_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_11,EXTI_CHANNEL_11_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_11,EXTI_CHANNEL_11_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_11);                               /* Enable EXTI11 channel interrupt. */
-    #endif
-    
-    /* If EXTI12 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_12_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_12,EXTI_CHANNEL_12_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_12,EXTI_CHANNEL_12_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_12);                               /* Enable EXTI12 channel interrupt. */
-    #endif
-    
-    /* If EXTI13 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_13_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_13,EXTI_CHANNEL_13_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_13,EXTI_CHANNEL_13_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_13);                               /* Enable EXTI13 channel interrupt. */
-    #endif
-    
-    /* If EXTI14 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_14_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_14,EXTI_CHANNEL_14_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_14,EXTI_CHANNEL_14_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_14);                               /* Enable EXTI14 channel interrupt. */
-    #endif
-    
-    /* If EXTI15 channel is enabled, Initialize it. */
-    #if(EXTI_CHANNEL_15_STATUS == EXTI_ENABLED_CHANNEL)
-    EXTI_setTriggerMode(EXTI_CHANNEL_15,EXTI_CHANNEL_15_TRIGGER_MODE);   /* Set the selected trigger mode. */
-    EXTI_setChannelSource(EXTI_CHANNEL_15,EXTI_CHANNEL_15_SOURCE);     /* Set the selected channel source. */
-    EXTI_enableChannel(EXTI_CHANNEL_15);                               /* Enable EXTI15 channel interrupt. */
+    const EXTI_channelConfigurationsType* LOC_ptr2configurations = NULL_PTR;
+    uint32 LOC_enabledChannels = 0;
+    uint32 LOC_risingChannels = 0;
+    uint32 LOC_fallingChannels = 0;
+    uint32 LOC_sourcesMasks[EXTI_NUMBER_OF_SOURCE_REGISTERS] = {0};
+    uint32 LOC_sourcesValues[EXTI_NUMBER_OF_SOURCE_REGISTERS] = {0};
+
+    /* The events timestamps are taken from the CPU cycle counter. */
+    DWT_enableCycleCounter();
+
+    /* The debounce times of all the channels are counted by one software timer, the debounce is off without it. */
+    #if(EXTI_ANY_CHANNEL_DEBOUNCED)
+    if(SYSTICK_createSoftwareTimer(EXTI_confirmDebounces,&G_debounceTimerID) == SYSTICK_NO_ERRORS)
+    {
+        G_debounceTimerCreated = TRUE;
+    }
     #endif
+
+    /* Build the registers values of all the enabled channels, so every register is written once. */
+    for(uint32 LOC_channel = EXTI_CHANNEL_00; LOC_channel < EXTI_NUMBER_OF_CHANNELS; LOC_channel++)
+    {
+        LOC_ptr2configurations = (G_channelsConfigurations + LOC_channel);
+
+        if(LOC_ptr2configurations->status == EXTI_ENABLED_CHANNEL)
+        {
+            SET_BIT(LOC_enabledChannels,LOC_channel);
+
+            if((LOC_ptr2configurations->triggerMode == EXTI_RISING_EDGE_TRIGGER) || (LOC_ptr2configurations->triggerMode == EXTI_ANY_CHANGE_TRIGGER))
+            {
+                SET_BIT(LOC_risingChannels,LOC_channel);
+            }
+
+            if((LOC_ptr2configurations->triggerMode == EXTI_FALLING_EDGE_TRIGGER) || (LOC_ptr2configurations->triggerMode == EXTI_ANY_CHANGE_TRIGGER))
+            {
+                SET_BIT(LOC_fallingChannels,LOC_channel);
+            }
+
+            *(LOC_sourcesMasks + (LOC_channel / 4U)) |= (0X0FUL << EXTI_GET_SOURCE_SHIFT(LOC_channel));
+            *(LOC_sourcesValues + (LOC_channel / 4U)) |= ((LOC_ptr2configurations->source & 0X0FUL) << EXTI_GET_SOURCE_SHIFT(LOC_channel));
+        }
+    }
+
+    /* Set the selected trigger modes and channels sources, the disabled channels keep their configurations. */
+    EXTI->RTSR = ((EXTI->RTSR & (~LOC_enabledChannels)) | LOC_risingChannels);
+    EXTI->FTSR = ((EXTI->FTSR & (~LOC_enabledChannels)) | LOC_fallingChannels);
+    for(uint8 LOC_register = 0; LOC_register < EXTI_NUMBER_OF_SOURCE_REGISTERS; LOC_register++)
+    {
+        *(&SYSCFG->EXTICR1 + LOC_register) = ((*(&SYSCFG->EXTICR1 + LOC_register) & (~(*(LOC_sourcesMasks + LOC_register)))) | *(LOC_sourcesValues + LOC_register));
+    }
+
+    /* Enable the interrupts of all the enabled channels. */
+    EXTI->IMR |= LOC_enabledChannels;
 }
 
 /*=====================================================================================================================
@@ -170,7 +175,7 @@ EXTI_errorStatusType EXTI_enableChannel(EXTI_channelIndexType a_channelIndex)
     else
     {
         /* Set the corresponding bit for the required channel to enable it. */
-        SET_BIT(EXTI->IMR,a_channelIndex);
+        BIT_BAND_SET_BIT(EXTI->IMR,a_channelIndex);
     }
 
     return LOC_errorStatus;
@@ -195,7 +200,12 @@ EXTI_errorStatusType EXTI_disableChannel(EXTI_channelIndexType a_channelIndex)
     else
     {
         /* Clear the corresponding bit for the required channel to disable it. */
-        CLEAR_BIT(EXTI->IMR,a_channelIndex);
+        BIT_BAND_CLEAR_BIT(EXTI->IMR,a_channelIndex);
+
+        /* Cancel the debounce of the channel, so it is not unmasked at the end of its debounce time. */
+        #if(EXTI_ANY_CHANNEL_DEBOUNCED)
+        __atomic_fetch_and(&G_debouncingChannels,~(1UL << a_channelIndex),__ATOMIC_RELAXED);
+        #endif
     }
 
     return LOC_errorStatus;
@@ -295,26 +305,26 @@ EXTI_errorStatusType EXTI_setTriggerMode(EXTI_channelIndexType a_channelIndex, E
         {
         case EXTI_FALLING_EDGE_TRIGGER:
             /* Enable the falling edge detection and disable the rising edge detection. */
-            SET_BIT(EXTI->FTSR,a_channelIndex);
-            CLEAR_BIT(EXTI->RTSR,a_channelIndex);
+            BIT_BAND_SET_BIT(EXTI->FTSR,a_channelIndex);
+            BIT_BAND_CLEAR_BIT(EXTI->RTSR,a_channelIndex);
             break;
         
         case EXTI_RISING_EDGE_TRIGGER:
             /* Enable the rising edge detection and disable the falling edge detection. */
-            SET_BIT(EXTI->RTSR,a_channelIndex);
-            CLEAR_BIT(EXTI->FTSR,a_channelIndex);
+            BIT_BAND_SET_BIT(EXTI->RTSR,a_channelIndex);
+            BIT_BAND_CLEAR_BIT(EXTI->FTSR,a_channelIndex);
             break;
         
         case EXTI_ANY_CHANGE_TRIGGER:
             /* Enable both the falling edge detection and the rising edge detection. */
-            SET_BIT(EXTI->FTSR,a_channelIndex);
-            SET_BIT(EXTI->RTSR,a_channelIndex);
+            BIT_BAND_SET_BIT(EXTI->FTSR,a_channelIndex);
+            BIT_BAND_SET_BIT(EXTI->RTSR,a_channelIndex);
             break;
         
         case EXTI_NO_EVENT_TRIGGER:
             /* Disable both the falling edge detection and the rising edge detection. */
-            CLEAR_BIT(EXTI->FTSR,a_channelIndex);
-            CLEAR_BIT(EXTI->RTSR,a_channelIndex);
+            BIT_BAND_CLEAR_BIT(EXTI->FTSR,a_channelIndex);
+            BIT_BAND_CLEAR_BIT(EXTI->RTSR,a_channelIndex);
             break;
         
         default:
@@ -358,6 +368,598 @@ EXTI_errorStatusType EXTI_setCallBackFunction(EXTI_channelIndexType a_channelInd
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : EXTI_setEventCallBackFunction
+ * [Description]   : Set the address of the event call-back function for a specific External Interrupt channel, it is
+ *                   called instead of the call-back function with the event [edge - timestamp] of the interrupt.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2callBackFunction> -> Pointer to the event call-back function.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_setEventCallBackFunction(EXTI_channelIndexType a_channelIndex, void (*a_ptr2callBackFunction)(EXTI_eventType*))
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+
+    if((a_channelIndex < EXTI_CHANNEL_00) || (a_channelIndex > EXTI_CHANNEL_15))
+    {
+        LOC_errorStatus = EXTI_CHANNEL_INDEX_ERROR;
+    }
+
+    else if(a_ptr2callBackFunction == NULL_PTR)
+    {
+        LOC_errorStatus = EXTI_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* Store the address of the event call-back function in the global array. */
+        *(G_eventCallBackFunctionsArray + a_channelIndex) = a_ptr2callBackFunction;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getDroppedEvents
+ * [Description]   : Get the number of the events dropped because the deferred events queue was full.
+ * [Arguments]     : <a_ptr2droppedEvents>    -> Pointer to variable to store the number of the dropped events.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getDroppedEvents(uint32* a_ptr2droppedEvents)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+
+    if(a_ptr2droppedEvents == NULL_PTR)
+    {
+        LOC_errorStatus = EXTI_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        *a_ptr2droppedEvents = G_droppedEvents;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getLastEvent
+ * [Description]   : Get the last event [edge - timestamp] of a specific External Interrupt channel.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2event>            -> Pointer to a structure to store the last event.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getLastEvent(EXTI_channelIndexType a_channelIndex, EXTI_eventType* a_ptr2event)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if((a_channelIndex < EXTI_CHANNEL_00) || (a_channelIndex > EXTI_CHANNEL_15))
+    {
+        LOC_errorStatus = EXTI_CHANNEL_INDEX_ERROR;
+    }
+
+    else if(a_ptr2event == NULL_PTR)
+    {
+        LOC_errorStatus = EXTI_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        a_ptr2event->channel = a_channelIndex;
+        a_ptr2event->edge = (EXTI_edgeType)(G_channelsCaptures + a_channelIndex)->lastEdge;
+        a_ptr2event->timestamp = (G_channelsCaptures + a_channelIndex)->lastTimestamp;
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getPulseCount
+ * [Description]   : Get the number of the edges detected on a specific External Interrupt channel.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2pulseCount>       -> Pointer to variable to store the number of the edges.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getPulseCount(EXTI_channelIndexType a_channelIndex, uint32* a_ptr2pulseCount)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+
+    if((a_channelIndex < EXTI_CHANNEL_00) || (a_channelIndex > EXTI_CHANNEL_15))
+    {
+        LOC_errorStatus = EXTI_CHANNEL_INDEX_ERROR;
+    }
+
+    else if(a_ptr2pulseCount == NULL_PTR)
+    {
+        LOC_errorStatus = EXTI_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        *a_ptr2pulseCount = (G_channelsCaptures + a_channelIndex)->pulseCount;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_resetPulseCount
+ * [Description]   : Reset the number of the edges and the period measurement of a specific External Interrupt channel.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_resetPulseCount(EXTI_channelIndexType a_channelIndex)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if((a_channelIndex < EXTI_CHANNEL_00) || (a_channelIndex > EXTI_CHANNEL_15))
+    {
+        LOC_errorStatus = EXTI_CHANNEL_INDEX_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        (G_channelsCaptures + a_channelIndex)->pulseCount = 0;
+        (G_channelsCaptures + a_channelIndex)->windowEdges = 0;
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getPeriod
+ * [Description]   : Get the average period between the edges of a specific channel since the previous call, then start
+ *                   a new averaging window. It must be called at least once every 2^32 CPU cycles while the edges are
+ *                   detected, and with both edges triggering the period is between the successive edges.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2period>           -> Pointer to variable to store the period in CPU cycles [0: No period].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getPeriod(EXTI_channelIndexType a_channelIndex, uint32* a_ptr2period)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+    EXTI_captureType* LOC_ptr2capture = NULL_PTR;
+    uint32 LOC_interruptsState = 0;
+
+    if((a_channelIndex < EXTI_CHANNEL_00) || (a_channelIndex > EXTI_CHANNEL_15))
+    {
+        LOC_errorStatus = EXTI_CHANNEL_INDEX_ERROR;
+    }
+
+    else if(a_ptr2period == NULL_PTR)
+    {
+        LOC_errorStatus = EXTI_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        LOC_ptr2capture = (G_channelsCaptures + a_channelIndex);
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        if(LOC_ptr2capture->windowEdges < EXTI_MIN_WINDOW_EDGES)
+        {
+            *a_ptr2period = 0;
+        }
+
+        else
+        {
+            /* Average the periods of the window, then start the next window from its last edge. */
+            *a_ptr2period = ((LOC_ptr2capture->lastTimestamp - LOC_ptr2capture->windowTimestamp) / (LOC_ptr2capture->windowEdges - 1U));
+            LOC_ptr2capture->windowTimestamp = LOC_ptr2capture->lastTimestamp;
+            LOC_ptr2capture->windowEdges = 1U;
+        }
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getFrequency
+ * [Description]   : Get the average frequency of the edges of a specific channel since the previous call, it is
+ *                   calculated from EXTI_getPeriod and the current CPU clock.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ *                   <a_ptr2frequency>        -> Pointer to variable to store the frequency in millihertz [0: No edges].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Channel Index Error.
+ ====================================================================================================================*/
+EXTI_errorStatusType EXTI_getFrequency(EXTI_channelIndexType a_channelIndex, uint32* a_ptr2frequency)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+    uint32 LOC_period = 0;
+    uint32 LOC_AHBClock = 0;
+
+    if(a_ptr2frequency == NULL_PTR)
+    {
+        LOC_errorStatus = EXTI_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        LOC_errorStatus = EXTI_getPeriod(a_channelIndex,&LOC_period);
+        RCC_getBusClockFrequency(RCC_AHB1_BUS,&LOC_AHBClock);
+        *a_ptr2frequency = ((LOC_period == 0) ? 0 : (uint32)(((uint64)LOC_AHBClock * EXTI_MILLIHERTZ_IN_HERTZ) / LOC_period));
+    }
+
+    return LOC_errorStatus;
+}
+
+#if(EXTI_ANY_CHANNEL_ENABLED)
+/*=====================================================================================================================
+ * [Function Name] : EXTI_getChannelEdge
+ * [Description]   : Get the edge of the last event of a specific channel from its trigger mode, and from the level of
+ *                   its source pin when both edges are detected.
+ * [Arguments]     : <a_channelIndex>         -> Indicates to the required channel.
+ * [return]        : The function returns the edge of the event.
+ ====================================================================================================================*/
+static EXTI_edgeType EXTI_getChannelEdge(uint32 a_channelIndex)
+{
+    EXTI_edgeType LOC_edge = EXTI_RISING_EDGE;
+
+    if(BIT_IS_CLEAR(EXTI->FTSR,a_channelIndex))
+    {
+        LOC_edge = EXTI_RISING_EDGE;
+    }
+
+    else if(BIT_IS_CLEAR(EXTI->RTSR,a_channelIndex))
+    {
+        LOC_edge = EXTI_FALLING_EDGE;
+    }
+
+    else
+    {
+        /* The pin level after a rising edge is high, and after a falling edge is low. */
+        LOC_edge = (BIT_IS_SET(EXTI_GPIO_IDR(EXTI_GET_CHANNEL_SOURCE(a_channelIndex)),a_channelIndex) ? EXTI_RISING_EDGE : EXTI_FALLING_EDGE);
+    }
+
+    return LOC_edge;
+}
+
+#if(EXTI_DISPATCH_MODE == EXTI_DEFERRED_DISPATCH)
+/*=====================================================================================================================
+ * [Function Name] : EXTI_pushEvent
+ * [Description]   : Queue an event without disabling the interrupts, every handler reserves a slot by an atomic
+ *                   compare-and-swap on the head [LDREX/STREX] so a handler that preempts another gets its own slot,
+ *                   then the slot is marked ready for PendSV after the event is written.
+ * [Arguments]     : <a_ptr2event>            -> Pointer to the event to be queued.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Queue Full Error.
+ ====================================================================================================================*/
+static EXTI_errorStatusType EXTI_pushEvent(EXTI_eventType* a_ptr2event)
+{
+    EXTI_errorStatusType LOC_errorStatus = EXTI_NO_ERRORS;
+    uint32 LOC_head = G_eventQueueHead;
+    uint32 LOC_slot = 0;
+
+    do
+    {
+        if((LOC_head - G_eventQueueTail) >= EXTI_EVENT_QUEUE_SIZE)
+        {
+            LOC_errorStatus = EXTI_QUEUE_FULL_ERROR;
+            break;
+        }
+    }while(!__atomic_compare_exchange_n(&G_eventQueueHead,&LOC_head,(LOC_head + 1U),FALSE,__ATOMIC_ACQ_REL,__ATOMIC_RELAXED));
+
+    if(LOC_errorStatus == EXTI_NO_ERRORS)
+    {
+        LOC_slot = (LOC_head & (EXTI_EVENT_QUEUE_SIZE - 1U));
+        *(G_eventQueue + LOC_slot) = *a_ptr2event;
+        __atomic_store_n((G_eventQueueReadyFlags + LOC_slot),TRUE,__ATOMIC_RELEASE);
+    }
+
+    else
+    {
+        __atomic_fetch_add(&G_droppedEvents,1U,__ATOMIC_RELAXED);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_requestDispatch
+ * [Description]   : Request the deferred dispatcher [PendSV], and keep the time of the first request since its last
+ *                   run to measure its latency when the interrupts instrumentation is enabled.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void EXTI_requestDispatch(void)
+{
+    #if(DWT_ISR_INSTRUMENTATION_STATUS == DWT_PROFILING_ENABLED)
+    uint32 LOC_interruptsState = 0;
+
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    if(G_dispatchRequested == FALSE)
+    {
+        G_dispatchRequestCycles = DWT_getCycleCount();
+        G_dispatchRequested = TRUE;
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    #endif
+
+    SCB_setExceptionPending(SCB_PENDSV_EXCEPTION);
+}
+
+#if(DWT_ISR_INSTRUMENTATION_STATUS == DWT_PROFILING_ENABLED)
+/*=====================================================================================================================
+ * [Function Name] : EXTI_takeDispatchLatency
+ * [Description]   : Get the cycles elapsed since the first PendSV request, then start waiting for the next request.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the latency in cycles, or DWT_UNKNOWN_LATENCY if PendSV was not requested
+ *                   by this driver.
+ ====================================================================================================================*/
+static uint32 EXTI_takeDispatchLatency(void)
+{
+    uint32 LOC_latency = DWT_UNKNOWN_LATENCY;
+    uint32 LOC_interruptsState = 0;
+
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    if(G_dispatchRequested == TRUE)
+    {
+        LOC_latency = (DWT_getCycleCount() - G_dispatchRequestCycles);
+        G_dispatchRequested = FALSE;
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+
+    return LOC_latency;
+}
+#endif
+#endif
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_dispatchEvent
+ * [Description]   : Capture the edge of an event in its channel counters, then call its call-back function or queue
+ *                   it according to the dispatch mode. The channels without call-back functions are only counted.
+ * [Arguments]     : <a_ptr2event>            -> Pointer to the event to be dispatched.
+ * [return]        : The function returns TRUE if the event is queued for PendSV, and FALSE otherwise.
+ ====================================================================================================================*/
+static uint8 EXTI_dispatchEvent(EXTI_eventType* a_ptr2event)
+{
+    uint8 LOC_eventQueued = FALSE;
+    EXTI_captureType* LOC_ptr2capture = (G_channelsCaptures + a_ptr2event->channel);
+
+    /* Count the edge and add it to the period averaging window. */
+    LOC_ptr2capture->lastTimestamp = a_ptr2event->timestamp;
+    LOC_ptr2capture->lastEdge = (uint8)a_ptr2event->edge;
+    if(LOC_ptr2capture->windowEdges == 0) LOC_ptr2capture->windowTimestamp = a_ptr2event->timestamp;
+    LOC_ptr2capture->windowEdges++;
+    LOC_ptr2capture->pulseCount++;
+
+    #if(EXTI_DISPATCH_MODE == EXTI_DEFERRED_DISPATCH)
+    if((*(G_eventCallBackFunctionsArray + a_ptr2event->channel) != NULL_PTR) || (*(G_callBackFunctionsArray + a_ptr2event->channel) != NULL_PTR))
+    {
+        LOC_eventQueued = (EXTI_pushEvent(a_ptr2event) == EXTI_NO_ERRORS);
+    }
+    #else
+    if(*(G_eventCallBackFunctionsArray + a_ptr2event->channel) != NULL_PTR)
+    {
+        (*(G_eventCallBackFunctionsArray + a_ptr2event->channel))(a_ptr2event);   /* Call the event call-back function. */
+    }
+
+    else if(*(G_callBackFunctionsArray + a_ptr2event->channel) != NULL_PTR)
+    {
+        (*(G_callBackFunctionsArray + a_ptr2event->channel))();                         /* Call the call-back function. */
+    }
+    #endif
+
+    return LOC_eventQueued;
+}
+
+#if(EXTI_ANY_CHANNEL_DEBOUNCED)
+/*=====================================================================================================================
+ * [Function Name] : EXTI_startDebounce
+ * [Description]   : Mask the interrupt of a debounced channel on its first edge and hold the edge, then start the
+ *                   debounce timer if no other channel is being debounced.
+ * [Arguments]     : <a_ptr2event>            -> Pointer to the first edge event of the channel.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void EXTI_startDebounce(EXTI_eventType* a_ptr2event)
+{
+    uint32 LOC_interruptsState = 0;
+    EXTI_debounceType* LOC_ptr2debounce = (G_channelsDebounces + a_ptr2event->channel);
+
+    LOC_ptr2debounce->timestamp = a_ptr2event->timestamp;
+    LOC_ptr2debounce->edge = (uint8)a_ptr2event->edge;
+    LOC_ptr2debounce->remainingTime = (G_channelsConfigurations + a_ptr2event->channel)->debounceTime;
+
+    /* The timer call-back function may stop the timer, so the channels mask and the timer are updated together. */
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    BIT_BAND_CLEAR_BIT(EXTI->IMR,a_ptr2event->channel);                           /* Mask the bounces of the channel. */
+    if(G_debouncingChannels == 0)
+    {
+        SYSTICK_startSoftwareTimer(G_debounceTimerID,EXTI_DEBOUNCE_TICK_TIME,SYSTICK_PERIODIC_TIMER);
+    }
+    SET_BIT(G_debouncingChannels,a_ptr2event->channel);
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_confirmDebounces
+ * [Description]   : The debounce timer call-back function, it counts the debounce time of every debounced channel.
+ *                   At the end of the time, the held edge is dispatched if the pin level still matches it, then the
+ *                   pending flag of the bounces is cleared and the channel is unmasked. The timer is stopped when no
+ *                   channel is being debounced.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void EXTI_confirmDebounces(void)
+{
+    uint32 LOC_interruptsState = 0;
+    uint32 LOC_debouncingChannels = G_debouncingChannels;
+    uint32 LOC_confirmedChannels = 0;
+    uint8 LOC_eventsQueued = FALSE;
+    EXTI_debounceType* LOC_ptr2debounce = NULL_PTR;
+    EXTI_edgeType LOC_levelEdge = EXTI_RISING_EDGE;
+    EXTI_eventType LOC_event = {EXTI_CHANNEL_00,EXTI_RISING_EDGE,0};
+    uint32 LOC_channel = EXTI_CHANNEL_00;
+
+    /* Visit only the channels being debounced, from the lowest set bit. */
+    while(LOC_debouncingChannels != 0)
+    {
+        LOC_channel = EXTI_GET_LOWEST_CHANNEL(LOC_debouncingChannels);
+        LOC_debouncingChannels &= (LOC_debouncingChannels - 1UL);                   /* Clear the lowest set bit. */
+        LOC_ptr2debounce = (G_channelsDebounces + LOC_channel);
+
+        if((--(LOC_ptr2debounce->remainingTime)) == 0)
+        {
+            SET_BIT(LOC_confirmedChannels,LOC_channel);
+
+            /* A high level confirms a rising edge, and a low level confirms a falling edge. */
+            LOC_levelEdge = (BIT_IS_SET(EXTI_GPIO_IDR(EXTI_GET_CHANNEL_SOURCE(LOC_channel)),LOC_channel) ? EXTI_RISING_EDGE : EXTI_FALLING_EDGE);
+
+            if(LOC_levelEdge == LOC_ptr2debounce->edge)
+            {
+                LOC_event.channel = (EXTI_channelIndexType)LOC_channel;
+                LOC_event.edge = LOC_levelEdge;
+                LOC_event.timestamp = LOC_ptr2debounce->timestamp;
+                LOC_eventsQueued |= EXTI_dispatchEvent(&LOC_event);
+            }
+        }
+    }
+
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    LOC_confirmedChannels &= G_debouncingChannels;                  /* Skip the channels disabled in their debounce. */
+    G_debouncingChannels &= (~LOC_confirmedChannels);
+    EXTI->PR = LOC_confirmedChannels;                               /* Clear the pending flags of the bounces.      */
+    EXTI->IMR |= LOC_confirmedChannels;                             /* Unmask the confirmed channels.               */
+    if(G_debouncingChannels == 0)
+    {
+        SYSTICK_stopSoftwareTimer(G_debounceTimerID);
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+
+    #if(EXTI_DISPATCH_MODE == EXTI_DEFERRED_DISPATCH)
+    if(LOC_eventsQueued == TRUE)
+    {
+        EXTI_requestDispatch();                                         /* Dispatch the queued events in PendSV. */
+    }
+    #else
+    (void)LOC_eventsQueued;
+    #endif
+}
+#endif
+
+/*=====================================================================================================================
+ * [Function Name] : EXTI_handleChannels
+ * [Description]   : Clear the pending flags of specific channels with one write, then dispatch the edge of each of
+ *                   them, or hold it until the end of its debounce time if the channel is debounced.
+ * [Arguments]     : <a_channelsMask>         -> Indicates to the channels of the interrupt handler.
+ *                   <a_timestamp>            -> Indicates to the cycle count at the entry of the interrupt handler.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void EXTI_handleChannels(uint32 a_channelsMask, uint32 a_timestamp)
+{
+    uint32 LOC_pendingChannels = (EXTI->PR & EXTI->IMR & a_channelsMask);
+    EXTI_eventType LOC_event = {EXTI_CHANNEL_00,EXTI_RISING_EDGE,a_timestamp};
+    uint8 LOC_eventsQueued = FALSE;
+    uint32 LOC_channel = EXTI_CHANNEL_00;
+
+    /* The pending flags are cleared by writing one, so only the read flags are cleared. */
+    EXTI->PR = LOC_pendingChannels;
+
+    /* Visit only the pending and enabled channels, from the lowest set bit. */
+    while(LOC_pendingChannels != 0)
+    {
+        LOC_channel = EXTI_GET_LOWEST_CHANNEL(LOC_pendingChannels);
+        LOC_pendingChannels &= (LOC_pendingChannels - 1UL);                         /* Clear the lowest set bit. */
+        LOC_event.channel = (EXTI_channelIndexType)LOC_channel;
+        LOC_event.edge = EXTI_getChannelEdge(LOC_channel);
+
+        #if(EXTI_ANY_CHANNEL_DEBOUNCED)
+        if(((G_channelsConfigurations + LOC_channel)->debounceTime != 0) && (G_debounceTimerCreated == TRUE))
+        {
+            EXTI_startDebounce(&LOC_event);
+        }
+
+        else
+        {
+            LOC_eventsQueued |= EXTI_dispatchEvent(&LOC_event);
+        }
+        #else
+        LOC_eventsQueued |= EXTI_dispatchEvent(&LOC_event);
+        #endif
+    }
+
+    #if(EXTI_DISPATCH_MODE == EXTI_DEFERRED_DISPATCH)
+    if(LOC_eventsQueued == TRUE)
+    {
+        EXTI_requestDispatch();                                         /* Dispatch the queued events in PendSV. */
+    }
+    #else
+    (void)LOC_eventsQueued;
+    #endif
+}
+#endif
+
+#if(EXTI_DISPATCH_MODE == EXTI_DEFERRED_DISPATCH)
+/*=====================================================================================================================
+ * [Function Name] : EXTI_popEvent
+ * [Description]   : Take the oldest ready event from the queue [only called by the PendSV handler].
+ * [Arguments]     : <a_ptr2event>            -> Pointer to store the event.
+ * [return]        : The function returns TRUE if an event is taken, and FALSE if the queue is empty.
+ ====================================================================================================================*/
+static uint8 EXTI_popEvent(EXTI_eventType* a_ptr2event)
+{
+    uint8 LOC_eventTaken = FALSE;
+    uint32 LOC_slot = (G_eventQueueTail & (EXTI_EVENT_QUEUE_SIZE - 1U));
+
+    /* A reserved slot is skipped until its handler marks it ready, so the events are dispatched in order. */
+    if(__atomic_load_n((G_eventQueueReadyFlags + LOC_slot),__ATOMIC_ACQUIRE) == TRUE)
+    {
+        *a_ptr2event = *(G_eventQueue + LOC_slot);
+        *(G_eventQueueReadyFlags + LOC_slot) = FALSE;
+        __atomic_store_n(&G_eventQueueTail,(G_eventQueueTail + 1U),__ATOMIC_RELEASE);
+        LOC_eventTaken = TRUE;
+    }
+
+    return LOC_eventTaken;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : PendSV_Handler
+ * [Description]   : The deferred dispatcher, it calls the call-back functions of all the queued events.
+ * [Arguments]     : The function Takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void PendSV_Handler(void)
+{
+    EXTI_eventType LOC_event;
+
+    /* The latency of the dispatcher is measured from the first request since its last run. */
+    DWT_ISR_ENTER_WITH_LATENCY(EXTI_takeDispatchLatency());
+
+    while(EXTI_popEvent(&LOC_event) == TRUE)
+    {
+        if(*(G_eventCallBackFunctionsArray + LOC_event.channel) != NULL_PTR)
+        {
+            (*(G_eventCallBackFunctionsArray + LOC_event.channel))(&LOC_event);
+        }
+
+        else if(*(G_callBackFunctionsArray + LOC_event.channel) != NULL_PTR)
+        {
+            (*(G_callBackFunctionsArray + LOC_event.channel))();
+        }
+    }
+
+    DWT_ISR_EXIT();
+}
+#endif
+
 /*=====================================================================================================================
  * [Function Name] : EXTI0_IRQHandler
  * [Description]   : The interrupt service routine for the EXTI0.
@@ -367,11 +969,11 @@ EXTI_errorStatusType EXTI_setCallBackFunction(EXTI_channelIndexType a_channelInd
 #if(EXTI_CHANNEL_00_STATUS == EXTI_ENABLED_CHANNEL)
 void EXTI0_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + EXTI_CHANNEL_00) != NULL_PTR)
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_00);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_00))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
+
+    DWT_ISR_ENTER();
+    EXTI_handleChannels((1UL << EXTI_CHANNEL_00),LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -384,11 +986,11 @@ void EXTI0_IRQHandler(void)
 #if(EXTI_CHANNEL_01_STATUS == EXTI_ENABLED_CHANNEL)
 void EXTI1_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + EXTI_CHANNEL_01) != NULL_PTR)
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_01);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_01))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
+
+    DWT_ISR_ENTER();
+    EXTI_handleChannels((1UL << EXTI_CHANNEL_01),LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -401,11 +1003,11 @@ void EXTI1_IRQHandler(void)
 #if(EXTI_CHANNEL_02_STATUS == EXTI_ENABLED_CHANNEL)
 void EXTI2_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + EXTI_CHANNEL_02) != NULL_PTR)
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_02);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_02))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
+
+    DWT_ISR_ENTER();
+    EXTI_handleChannels((1UL << EXTI_CHANNEL_02),LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -418,11 +1020,11 @@ void EXTI2_IRQHandler(void)
 #if(EXTI_CHANNEL_03_STATUS == EXTI_ENABLED_CHANNEL)
 void EXTI3_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + EXTI_CHANNEL_03) != NULL_PTR)
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_03);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_03))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
+
+    DWT_ISR_ENTER();
+    EXTI_handleChannels((1UL << EXTI_CHANNEL_03),LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -435,11 +1037,11 @@ void EXTI3_IRQHandler(void)
 #if(EXTI_CHANNEL_04_STATUS == EXTI_ENABLED_CHANNEL)
 void EXTI4_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + EXTI_CHANNEL_04) != NULL_PTR)
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_04);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_04))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
+
+    DWT_ISR_ENTER();
+    EXTI_handleChannels((1UL << EXTI_CHANNEL_04),LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -454,35 +1056,11 @@ void EXTI4_IRQHandler(void)
  ====================================================================================================================*/
 void EXTI9_5_IRQHandler(void)
 {
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_05)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_05) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_05);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_05))();                 /* Call the call-back function. */
-    }
-    
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_06)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_06) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_06);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_06))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
 
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_07)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_07) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_07);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_07))();                 /* Call the call-back function. */
-    }
-
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_08)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_08) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_08);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_08))();                 /* Call the call-back function. */
-    }
-
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_09)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_09) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_09);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_09))();                 /* Call the call-back function. */
-    }
+    DWT_ISR_ENTER();
+    EXTI_handleChannels(EXTI_CHANNELS_09_05_MASK,LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -497,40 +1075,10 @@ void EXTI9_5_IRQHandler(void)
  ====================================================================================================================*/
 void EXTI15_10_IRQHandler(void)
 {
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_10)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_10) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_10);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_10))();                 /* Call the call-back function. */
-    }
-    
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_11)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_11) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_11);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_11))();                 /* Call the call-back function. */
-    }
-
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_12)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_12) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_12);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_12))();                 /* Call the call-back function. */
-    }
-
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_13)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_13) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_13);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_13))();                 /* Call the call-back function. */
-    }
-
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_14)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_14) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_14);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_14))();                 /* Call the call-back function. */
-    }
+    uint32 LOC_timestamp = DWT_getCycleCount();                      /* Take the timestamp first. */
 
-    if((BIT_IS_SET(EXTI->PR,EXTI_CHANNEL_15)) && (*(G_callBackFunctionsArray + EXTI_CHANNEL_15) != NULL_PTR))
-    {
-        SET_BIT(EXTI->PR,EXTI_CHANNEL_15);                                      /* Clear the pending flag. */
-        (*(G_callBackFunctionsArray + EXTI_CHANNEL_15))();                 /* Call the call-back function. */
-    }
+    DWT_ISR_ENTER();
+    EXTI_handleChannels(EXTI_CHANNELS_15_10_MASK,LOC_timestamp);
+    DWT_ISR_EXIT();
 }
 #endif
@@ -0,0 +1,74 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : FLASH
+File Name    : flash.h
+Date Created : Oct 17, 2026
+Description  : Interface file for the STM32F401xx FLASH interface driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_FLASH_INCLUDES_FLASH_H_
+#define MCAL_FLASH_INCLUDES_FLASH_H_
+
+/*=====================================================================================================================
+                                       < User-defined Data Types >
+=====================================================================================================================*/
+
+typedef enum
+{
+    FLASH_NO_ERRORS,                         /* All Good.                       */
+    FLASH_NULL_PTR_ERROR,                    /* Null Pointer Error.             */
+    FLASH_LATENCY_ERROR,                     /* Wrong Latency Error.            */
+    FLASH_FREQUENCY_ERROR,                   /* Unsupported HCLK Frequency.     */
+    FLASH_FUNCTION_TIMEOUT_ERROR,            /* Function Timeout Ended Error.   */
+}FLASH_errorStatusType;
+
+typedef enum
+{
+    FLASH_ZERO_WAIT_STATE,                   /* Zero Wait State [1 CPU cycle].     */
+    FLASH_ONE_WAIT_STATE,                    /* One Wait State [2 CPU cycles].     */
+    FLASH_TWO_WAIT_STATES,                   /* Two Wait States [3 CPU cycles].    */
+    FLASH_THREE_WAIT_STATES,                 /* Three Wait States [4 CPU cycles].  */
+    FLASH_FOUR_WAIT_STATES,                  /* Four Wait States [5 CPU cycles].   */
+    FLASH_FIVE_WAIT_STATES,                  /* Five Wait States [6 CPU cycles].   */
+    FLASH_SIX_WAIT_STATES,                   /* Six Wait States [7 CPU cycles].    */
+    FLASH_SEVEN_WAIT_STATES,                 /* Seven Wait States [8 CPU cycles].  */
+}FLASH_latencyType;
+
+/*=====================================================================================================================
+                                         < Functions Prototypes >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_setLatency
+ * [Description]   : Set the number of wait states of the FLASH memory access and wait until it is taken into account.
+ * [Arguments]     : <a_latency>      -> Indicates to the required number of wait states.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Latency Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+FLASH_errorStatusType FLASH_setLatency(FLASH_latencyType a_latency);
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_getLatency
+ * [Description]   : Get the current number of wait states of the FLASH memory access.
+ * [Arguments]     : <a_ptr2latency>  -> Pointer to variable to store the current number of wait states.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+FLASH_errorStatusType FLASH_getLatency(FLASH_latencyType* a_ptr2latency);
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_configureForFrequency
+ * [Description]   : Set the minimum legal number of wait states for a specific HCLK frequency in the configured supply
+ *                   voltage range, and enable the configured accelerator features [Prefetch - I-Cache - D-Cache].
+ * [Arguments]     : <a_HCLKFrequency>  -> Indicates to the HCLK frequency in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Frequency Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+FLASH_errorStatusType FLASH_configureForFrequency(uint32 a_HCLKFrequency);
+
+#endif /* MCAL_FLASH_INCLUDES_FLASH_H_ */
@@ -0,0 +1,37 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : FLASH
+File Name    : flash_cfg.h
+Date Created : Oct 17, 2026
+Description  : Configuration file for the STM32F401xx FLASH interface driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_FLASH_INCLUDES_FLASH_CFG_H_
+#define MCAL_FLASH_INCLUDES_FLASH_CFG_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+Set the supply voltage range of the device with one of these options: 1- FLASH_VOLTAGE_RANGE_2V7_TO_3V6
+                                                                      2- FLASH_VOLTAGE_RANGE_2V4_TO_2V7
+                                                                      3- FLASH_VOLTAGE_RANGE_2V1_TO_2V4
+                                                                      4- FLASH_VOLTAGE_RANGE_1V71_TO_2V1
+The minimum number of wait states for every HCLK frequency is calculated according to this range.
+=====================================================================================================================*/
+#define FLASH_SUPPLY_VOLTAGE_RANGE             (FLASH_VOLTAGE_RANGE_2V7_TO_3V6)
+
+/*=====================================================================================================================
+Set the status of every FLASH accelerator feature with one of these options: 1- FLASH_ENABLED_FEATURE
+                                                                             2- FLASH_DISABLED_FEATURE
+The prefetch buffer must be disabled in the 1.71 V to 2.1 V range.
+=====================================================================================================================*/
+#define FLASH_PREFETCH_STATUS                  (FLASH_ENABLED_FEATURE)
+#define FLASH_INSTRUCTION_CACHE_STATUS         (FLASH_ENABLED_FEATURE)
+#define FLASH_DATA_CACHE_STATUS                (FLASH_ENABLED_FEATURE)
+
+#endif /* MCAL_FLASH_INCLUDES_FLASH_CFG_H_ */
@@ -0,0 +1,74 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : FLASH
+File Name    : flash_prv.h
+Date Created : Oct 17, 2026
+Description  : Private file for the STM32F401xx FLASH interface driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_FLASH_INCLUDES_FLASH_PRV_H_
+#define MCAL_FLASH_INCLUDES_FLASH_PRV_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* FLASH supply voltage ranges, each option is the maximum HCLK frequency for every wait state in this range. */
+#define FLASH_VOLTAGE_RANGE_2V7_TO_3V6               (30000000UL)
+#define FLASH_VOLTAGE_RANGE_2V4_TO_2V7               (24000000UL)
+#define FLASH_VOLTAGE_RANGE_2V1_TO_2V4               (18000000UL)
+#define FLASH_VOLTAGE_RANGE_1V71_TO_2V1              (16000000UL)
+
+/* FLASH accelerator features status [Prefetch - Instruction Cache - Data Cache]. */
+#define FLASH_DISABLED_FEATURE                       (0U)
+#define FLASH_ENABLED_FEATURE                        (1U)
+
+/* The maximum HCLK frequency supported by the FLASH interface. */
+#define FLASH_MAX_HCLK_FREQUENCY                     (84000000UL)
+
+/* The timeout used while waiting for the new latency to be taken into account. */
+#define FLASH_FUNCTION_TIMEOUT_VALUE                 (1000UL)
+
+/*=====================================================================================================================
+                                       < User-defined Data Types >
+=====================================================================================================================*/
+
+typedef struct
+{
+    volatile uint32 ACR;                             /* Flash access control register.    */
+    volatile uint32 KEYR;                            /* Flash key register.               */
+    volatile uint32 OPTKEYR;                         /* Flash option key register.        */
+    volatile uint32 SR;                              /* Flash status register.            */
+    volatile uint32 CR;                              /* Flash control register.           */
+    volatile uint32 OPTCR;                           /* Flash option control register.    */
+}FLASH_registersType;
+
+/*=====================================================================================================================
+                                < Peripheral Registers and Bits Definitions >
+=====================================================================================================================*/
+
+/* FLASH interface registers base address. */
+#define FLASH                                        ((volatile FLASH_registersType*)0X40023C00)
+
+/* ACR register fields and bits number. */
+#define FLASH_ACR_LATENCY_FIELD                      (0UL)
+#define FLASH_ACR_PRFTEN_BIT                         (8UL)
+#define FLASH_ACR_ICEN_BIT                           (9UL)
+#define FLASH_ACR_DCEN_BIT                           (10UL)
+#define FLASH_ACR_ICRST_BIT                          (11UL)
+#define FLASH_ACR_DCRST_BIT                          (12UL)
+
+/* The LATENCY field mask in the ACR register. */
+#define FLASH_ACR_LATENCY_MASK                       (0X0FUL)
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the minimum number of wait states for a specific HCLK frequency in the configured supply voltage range. */
+#define FLASH_GET_MINIMUM_LATENCY(HCLK)              (((HCLK) == 0UL) ? 0UL : (((uint32)(HCLK) - 1UL) / FLASH_SUPPLY_VOLTAGE_RANGE))
+
+#endif /* MCAL_FLASH_INCLUDES_FLASH_PRV_H_ */
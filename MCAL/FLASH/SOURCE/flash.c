@@ -0,0 +1,138 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : FLASH
+File Name    : flash.c
+Date Created : Oct 17, 2026
+Description  : Source file for the STM32F401xx FLASH interface driver.
+=======================================================================================================================
+*/
+
+
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "../../../OTHERS/std_types.h"
+#include "../../../OTHERS/common_macros.h"
+#include "../INCLUDES/flash_prv.h"
+#include "../INCLUDES/flash_cfg.h"
+#include "../INCLUDES/flash.h"
+
+/*=====================================================================================================================
+                                          < Functions Definitions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_enableAccelerator
+ * [Description]   : Enable the configured FLASH accelerator features, the caches are reset before being enabled so
+ *                   they do not hold invalid lines from before they were disabled.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void FLASH_enableAccelerator(void)
+{
+    #if(FLASH_PREFETCH_STATUS == FLASH_ENABLED_FEATURE)
+    SET_BIT(FLASH->ACR,FLASH_ACR_PRFTEN_BIT);
+    #endif
+
+    #if(FLASH_INSTRUCTION_CACHE_STATUS == FLASH_ENABLED_FEATURE)
+    if(BIT_IS_CLEAR(FLASH->ACR,FLASH_ACR_ICEN_BIT))
+    {
+        SET_BIT(FLASH->ACR,FLASH_ACR_ICRST_BIT);                         /* Reset the instruction cache.  */
+        CLEAR_BIT(FLASH->ACR,FLASH_ACR_ICRST_BIT);
+        SET_BIT(FLASH->ACR,FLASH_ACR_ICEN_BIT);                          /* Enable the instruction cache. */
+    }
+    #endif
+
+    #if(FLASH_DATA_CACHE_STATUS == FLASH_ENABLED_FEATURE)
+    if(BIT_IS_CLEAR(FLASH->ACR,FLASH_ACR_DCEN_BIT))
+    {
+        SET_BIT(FLASH->ACR,FLASH_ACR_DCRST_BIT);                         /* Reset the data cache.         */
+        CLEAR_BIT(FLASH->ACR,FLASH_ACR_DCRST_BIT);
+        SET_BIT(FLASH->ACR,FLASH_ACR_DCEN_BIT);                          /* Enable the data cache.        */
+    }
+    #endif
+}
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_setLatency
+ * [Description]   : Set the number of wait states of the FLASH memory access and wait until it is taken into account.
+ * [Arguments]     : <a_latency>      -> Indicates to the required number of wait states.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Latency Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+FLASH_errorStatusType FLASH_setLatency(FLASH_latencyType a_latency)
+{
+    FLASH_errorStatusType LOC_errorStatus = FLASH_NO_ERRORS;
+    uint32 LOC_functionTimeout = FLASH_FUNCTION_TIMEOUT_VALUE;
+
+    if((a_latency < FLASH_ZERO_WAIT_STATE) || (a_latency > FLASH_SEVEN_WAIT_STATES))
+    {
+        LOC_errorStatus = FLASH_LATENCY_ERROR;
+    }
+
+    else
+    {
+        /* Set the required number of wait states. */
+        FLASH->ACR = ((FLASH->ACR & (~(FLASH_ACR_LATENCY_MASK << FLASH_ACR_LATENCY_FIELD))) | ((uint32)a_latency << FLASH_ACR_LATENCY_FIELD));
+        /* Wait until the new number of wait states is read back from the register or the timeout has ended. */
+        while((((FLASH->ACR >> FLASH_ACR_LATENCY_FIELD) & FLASH_ACR_LATENCY_MASK) != a_latency) && (--LOC_functionTimeout));
+        /* If the function's timeout has ended, return the Function Timeout error. */
+        if(LOC_functionTimeout == 0) LOC_errorStatus = FLASH_FUNCTION_TIMEOUT_ERROR;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_getLatency
+ * [Description]   : Get the current number of wait states of the FLASH memory access.
+ * [Arguments]     : <a_ptr2latency>  -> Pointer to variable to store the current number of wait states.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+FLASH_errorStatusType FLASH_getLatency(FLASH_latencyType* a_ptr2latency)
+{
+    FLASH_errorStatusType LOC_errorStatus = FLASH_NO_ERRORS;
+
+    if(a_ptr2latency == NULL_PTR)
+    {
+        LOC_errorStatus = FLASH_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        *a_ptr2latency = (FLASH_latencyType)((FLASH->ACR >> FLASH_ACR_LATENCY_FIELD) & FLASH_ACR_LATENCY_MASK);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : FLASH_configureForFrequency
+ * [Description]   : Set the minimum legal number of wait states for a specific HCLK frequency in the configured supply
+ *                   voltage range, and enable the configured accelerator features [Prefetch - I-Cache - D-Cache].
+ * [Arguments]     : <a_HCLKFrequency>  -> Indicates to the HCLK frequency in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Frequency Error.
+ *                                                          - Function Timeout Error.
+ ====================================================================================================================*/
+FLASH_errorStatusType FLASH_configureForFrequency(uint32 a_HCLKFrequency)
+{
+    FLASH_errorStatusType LOC_errorStatus = FLASH_NO_ERRORS;
+
+    if((a_HCLKFrequency > FLASH_MAX_HCLK_FREQUENCY) || (FLASH_GET_MINIMUM_LATENCY(a_HCLKFrequency) > FLASH_SEVEN_WAIT_STATES))
+    {
+        LOC_errorStatus = FLASH_FREQUENCY_ERROR;
+    }
+
+    else
+    {
+        LOC_errorStatus = FLASH_setLatency((FLASH_latencyType)FLASH_GET_MINIMUM_LATENCY(a_HCLKFrequency));
+        FLASH_enableAccelerator();
+    }
+
+    return LOC_errorStatus;
+}
@@ -12,6 +12,20 @@ Description  : Interface file for the STM32F401xx GPIO peripheral driver.
 #ifndef MCAL_GPIO_INCLUDES_GPIO_H_
 #define MCAL_GPIO_INCLUDES_GPIO_H_
 
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+/* The base addresses of the ports and the offsets of the data registers used by the inline fast path functions. */
+#include "gpio_addresses.h"
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* The reset bits of the BSRR register start after its 16 set bits. */
+#define GPIO_BSRR_RESET_SHIFT            (16U)
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
@@ -25,6 +39,8 @@ typedef enum
     GPIO_PIN_MODE_ERROR,             /* Wrong Pin Mode Error.   */
     GPIO_PIN_SPEED_ERROR,            /* Wrong Pin Speed Error.  */
     GPIO_PIN_STATUS_ERROR,           /* Wrong Pin Status Error. */
+    GPIO_DMA_ERROR,                  /* DMA Transfer Error.     */
+    GPIO_REPEATED_PIN_ERROR,         /* Repeated Pin Error.     */
 }GPIO_errorStatusType;
 
 typedef enum
@@ -111,6 +127,71 @@ typedef struct
     GPIO_pinSpeedType pinSpeed;      /* Pin speed in output mode [Low - Medium - High - Very High]. */
 }GPIO_pinConfigurationsType;
 
+typedef struct
+{
+    uint32 portBase;                 /* The base address of the pin port.              */
+    uint32 pinMask;                  /* The bit of the pin in the port data registers. */
+}GPIO_pinHandleType;
+
+typedef struct
+{
+    GPIO_portIDType portID;          /* Port ID [PORTA - PORTB - PORTC - PORTD - PORTE - PORTH]. */
+    uint16 pinsMask;                 /* The pins to be written [bit n: Pin n].                   */
+    uint16 pinsValue;                /* The logic of the written pins [bit n: Pin n].            */
+}GPIO_portWriteType;
+
+typedef struct
+{
+    uint8 portID;                    /* The port of the changed pin [GPIO_portIDType]. */
+    uint8 pinID;                     /* The changed pin [GPIO_pinIDType].              */
+    uint8 pinStatus;                 /* The new logic of the pin [High - Low].         */
+}GPIO_pinEventType;
+
+typedef struct
+{
+    uint16 pinsMasks[GPIO_PORTH_ID + 1];  /* The scanned pins of each port ID [bit n: Pin n - 0: Port not scanned]. */
+    uint16 snapshot[GPIO_PORTH_ID + 1];   /* The pins logic of the last scan [maintained by the scanner].           */
+}GPIO_scannerType;
+
+typedef struct
+{
+    uint8 rowPinID;                  /* The row pin of the changed key [GPIO_pinIDType].                    */
+    uint8 columnPinID;               /* The column pin of the changed key [GPIO_pinIDType].                 */
+    uint8 keyStatus;                 /* The new logic read by the column [Low: Pressed - High: Released].   */
+}GPIO_keyEventType;
+
+typedef struct
+{
+    GPIO_portIDType rowsPortID;           /* The port of the rows, driven Low one at a time [output pins].            */
+    GPIO_portIDType columnsPortID;        /* The port of the columns, read for every row [pulled-up input pins].      */
+    uint16 rowsMask;                      /* The row pins [bit n: Pin n].                                             */
+    uint16 columnsMask;                   /* The column pins [bit n: Pin n].                                          */
+    uint32 settleCycles;                  /* The CPU cycles waited after driving a row before reading the columns.    */
+    uint16 snapshot[GPIO_PIN15_ID + 1];   /* The pressed columns of each row pin [maintained by the scanner].         */
+}GPIO_matrixType;
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the base address of a specific port [GPIO_portIDType], PORTH is not contiguous with the other ports. */
+#define GPIO_GET_PORT_BASE_ADDRESS(PORT_ID)                                                                           \
+    (((PORT_ID) == GPIO_PORTH_ID) ? GPIO_PORTH_BASE_ADDRESS : (GPIO_PORTA_BASE_ADDRESS + ((uint32)(PORT_ID) * GPIO_PORT_ADDRESS_STEP)))
+
+/* Get the handle of a specific pin for the inline fast path functions, it is resolved at compile time when the port
+ * and the pin IDs are constants, e.g. #define LED_PIN GPIO_PIN_HANDLE(GPIO_PORTC_ID,GPIO_PIN13_ID) */
+#define GPIO_PIN_HANDLE(PORT_ID,PIN_ID)  ((GPIO_pinHandleType){GPIO_GET_PORT_BASE_ADDRESS(PORT_ID),(1UL << (PIN_ID))})
+
+/* Get the handle of a group of pins on the same port [bit n: Pin n] for GPIO_writePinsFast, e.g. a 4-bit data bus. */
+#define GPIO_PINS_HANDLE(PORT_ID,PINS_MASK)  ((GPIO_pinHandleType){GPIO_GET_PORT_BASE_ADDRESS(PORT_ID),((uint32)(PINS_MASK) & 0XFFFFUL)})
+
+/* Get the waveform word that sets and resets specific pins of a port in one step [bit n: Pin n], a pin in both masks
+ * is set. */
+#define GPIO_WAVEFORM_WORD(SET_PINS,RESET_PINS)  ((((uint32)(RESET_PINS) & 0XFFFFUL) << GPIO_BSRR_RESET_SHIFT) | ((uint32)(SET_PINS) & 0XFFFFUL))
+
+/* Access a specific data register of the port of a pin handle. */
+#define GPIO_HANDLE_REGISTER(HANDLE,OFFSET)  (*((volatile uint32*)((HANDLE).portBase + (OFFSET))))
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
@@ -136,6 +217,23 @@ void GPIO_init(void);
  ====================================================================================================================*/
 GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configurations);
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_configurePins
+ * [Description]   : Configure multiple GPIO pins on any ports, the registers values are composed for every port so each
+ *                   configuration register is written once per port. No pin is configured if any configuration is
+ *                   wrong or repeated in the array.
+ * [Arguments]     : <a_ptr2configurations>      -> Pointer to an array of structures that hold the configurations.
+ *                   <a_numberOfPins>            -> Indicates to the number of the configurations in the array.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ *                                                          - Speed Error.
+ *                                                          - Mode Error.
+ *                                                          - Repeated Pin Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_configurePins(const GPIO_pinConfigurationsType* a_ptr2configurations, uint8 a_numberOfPins);
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_writePin
  * [Description]   : Write a specific logic [High or Low] on a specific pin.
@@ -172,6 +270,68 @@ GPIO_errorStatusType GPIO_writePinAtomic(GPIO_portIDType a_portID, GPIO_pinIDTyp
  ====================================================================================================================*/
 GPIO_errorStatusType GPIO_writePort(GPIO_portIDType a_portID, uint16 a_portValue);
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePortMasked
+ * [Description]   : Write a specific value on a group of pins of a certain port with a single atomic store to BSRR,
+ *                   the other pins of the port are not affected.
+ * [Arguments]     : <a_portID>      -> Indicates to the required port ID.
+ *                   <a_pinsMask>    -> Indicates to the pins to be written [bit n: Pin n].
+ *                   <a_pinsValue>   -> Indicates to the logic of the written pins [bit n: Pin n].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_writePortMasked(GPIO_portIDType a_portID, uint16 a_pinsMask, uint16 a_pinsValue);
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePortsMasked
+ * [Description]   : Write specific values on groups of pins of multiple ports, the writes of the same port are merged
+ *                   and every used port is written with one BSRR store. The stores are issued back to back with the
+ *                   interrupts disabled, so the ports are updated within a few cycles of each other. No port is
+ *                   written if any port ID is wrong or if two writes of the same port share a pin.
+ * [Arguments]     : <a_ptr2writes>        -> Pointer to an array of structures that hold the masked writes.
+ *                   <a_numberOfWrites>    -> Indicates to the number of the writes in the array.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Repeated Pin Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_writePortsMasked(const GPIO_portWriteType* a_ptr2writes, uint8 a_numberOfWrites);
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_playWaveform
+ * [Description]   : Replay a table of waveform words [GPIO_WAVEFORM_WORD] on a certain port, every word is stored to
+ *                   BSRR at a fixed number of CPU cycles after the previous one. The steps are paced by the DWT cycle
+ *                   counter against absolute deadlines, so the timing errors do not accumulate, and the interrupts are
+ *                   disabled during the replay. A zero step replays the words back to back as fast as the CPU allows.
+ *                   The cycle counter must be enabled by DWT_enableCycleCounter when the step is not zero, and the
+ *                   step must be longer than the loop overhead [about 10 cycles] to be kept.
+ * [Arguments]     : <a_portID>          -> Indicates to the required port ID.
+ *                   <a_ptr2words>       -> Pointer to the array of the waveform words.
+ *                   <a_numberOfWords>   -> Indicates to the number of the words in the array.
+ *                   <a_stepCycles>      -> Indicates to the duration of each step in CPU cycles [0: No pacing].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_playWaveform(GPIO_portIDType a_portID, const uint32* a_ptr2words, uint16 a_numberOfWords, uint32 a_stepCycles);
+
+#if(GPIO_WAVEFORM_DMA_STATUS == GPIO_WAVEFORM_DMA_ENABLED)
+/*=====================================================================================================================
+ * [Function Name] : GPIO_startWaveformBurst
+ * [Description]   : Start copying a table of waveform words [GPIO_WAVEFORM_WORD] to the BSRR of a certain port by the
+ *                   configured DMA2 stream, then return without waiting for the end of the burst. The table must stay
+ *                   valid until the end of the burst [GPIO_WAVEFORM_DMA_STATUS must be enabled].
+ * [Arguments]     : <a_portID>          -> Indicates to the required port ID.
+ *                   <a_ptr2words>       -> Pointer to the array of the waveform words.
+ *                   <a_numberOfWords>   -> Indicates to the number of the words in the array.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - DMA Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_startWaveformBurst(GPIO_portIDType a_portID, const uint32* a_ptr2words, uint16 a_numberOfWords);
+#endif
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_readPin
  * [Description]   : Read the logic of a specific pin [High - LOW].
@@ -196,6 +356,60 @@ GPIO_errorStatusType GPIO_readPin(GPIO_portIDType a_portID, GPIO_pinIDType a_pin
  ====================================================================================================================*/
 GPIO_errorStatusType GPIO_readPort(GPIO_portIDType a_portID, uint16* a_ptr2portValue);
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_initScanner
+ * [Description]   : Take the first snapshot of the scanned pins of a port scanner, the pins masks must be set first.
+ * [Arguments]     : <a_ptr2scanner>     -> Pointer to the required port scanner.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_initScanner(GPIO_scannerType* a_ptr2scanner);
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_scanPorts
+ * [Description]   : Read the input data register of every scanned port once, compare it with the last snapshot and
+ *                   report the changed pins only. If the events array is full, the remaining changes are kept out of
+ *                   the snapshot and reported by the next scan.
+ * [Arguments]     : <a_ptr2scanner>         -> Pointer to the required port scanner.
+ *                   <a_ptr2events>          -> Pointer to an array to store the events of the changed pins.
+ *                   <a_maxEvents>           -> Indicates to the size of the events array.
+ *                   <a_ptr2numberOfEvents>  -> Pointer to variable to store the number of the stored events.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_scanPorts(GPIO_scannerType* a_ptr2scanner, GPIO_pinEventType* a_ptr2events, uint8 a_maxEvents, uint8* a_ptr2numberOfEvents);
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_initMatrix
+ * [Description]   : Check the configurations of a keys matrix, drive all its rows High and clear its snapshot, so the
+ *                   keys held at the first scan are reported as pressed.
+ * [Arguments]     : <a_ptr2matrix>      -> Pointer to the required keys matrix.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_initMatrix(GPIO_matrixType* a_ptr2matrix);
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_scanMatrix
+ * [Description]   : Drive every row of a keys matrix Low with one BSRR store, wait the settle time, read the columns
+ *                   with one IDR read, then report the changed keys only. If the events array is full, the remaining
+ *                   changes are reported by the next scan. The cycle counter must be enabled by DWT_enableCycleCounter
+ *                   when the settle time is not zero.
+ * [Arguments]     : <a_ptr2matrix>          -> Pointer to the required keys matrix.
+ *                   <a_ptr2events>          -> Pointer to an array to store the events of the changed keys.
+ *                   <a_maxEvents>           -> Indicates to the size of the events array.
+ *                   <a_ptr2numberOfEvents>  -> Pointer to variable to store the number of the stored events.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_scanMatrix(GPIO_matrixType* a_ptr2matrix, GPIO_keyEventType* a_ptr2events, uint8 a_maxEvents, uint8* a_ptr2numberOfEvents);
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_togglePin
  * [Description]   : Toggle the logic of a specific pin.
@@ -231,4 +445,81 @@ GPIO_errorStatusType GPIO_setPinFunction(GPIO_portIDType a_portID, GPIO_pinIDTyp
  ====================================================================================================================*/
 GPIO_errorStatusType GPIO_lockPin(GPIO_portIDType a_portID, GPIO_pinIDType a_pinID);
 
+/*=====================================================================================================================
+                                          < Inline Functions >
+=====================================================================================================================*/
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_setPinFast
+ * [Description]   : Drive a specific pin High with a single atomic store to BSRR, the handle is not validated.
+ * [Arguments]     : <a_pinHandle>   -> Indicates to the handle of the required pin [GPIO_PIN_HANDLE].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static inline void GPIO_setPinFast(GPIO_pinHandleType a_pinHandle)
+{
+    GPIO_HANDLE_REGISTER(a_pinHandle,GPIO_BSRR_OFFSET) = a_pinHandle.pinMask;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_clearPinFast
+ * [Description]   : Drive a specific pin Low with a single atomic store to BSRR, the handle is not validated.
+ * [Arguments]     : <a_pinHandle>   -> Indicates to the handle of the required pin [GPIO_PIN_HANDLE].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static inline void GPIO_clearPinFast(GPIO_pinHandleType a_pinHandle)
+{
+    GPIO_HANDLE_REGISTER(a_pinHandle,GPIO_BSRR_OFFSET) = (a_pinHandle.pinMask << GPIO_BSRR_RESET_SHIFT);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePinFast
+ * [Description]   : Write a specific logic [High or Low] on a specific pin with a single atomic store to BSRR without
+ *                   branches, the arguments are not validated.
+ * [Arguments]     : <a_pinHandle>   -> Indicates to the handle of the required pin [GPIO_PIN_HANDLE].
+ *                   <a_pinStatus>   -> Indicates to the value [High - Low].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static inline void GPIO_writePinFast(GPIO_pinHandleType a_pinHandle, GPIO_pinStatusType a_pinStatus)
+{
+    GPIO_HANDLE_REGISTER(a_pinHandle,GPIO_BSRR_OFFSET) = (a_pinHandle.pinMask << ((a_pinStatus == GPIO_LOW_PIN) * GPIO_BSRR_RESET_SHIFT));
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePinsFast
+ * [Description]   : Write a specific value on the group of pins of a handle with a single atomic store to BSRR, the
+ *                   arguments are not validated.
+ * [Arguments]     : <a_pinsHandle>  -> Indicates to the handle of the required pins [GPIO_PINS_HANDLE].
+ *                   <a_pinsValue>   -> Indicates to the logic of the pins [bit n: Pin n, other bits ignored].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static inline void GPIO_writePinsFast(GPIO_pinHandleType a_pinsHandle, uint32 a_pinsValue)
+{
+    GPIO_HANDLE_REGISTER(a_pinsHandle,GPIO_BSRR_OFFSET) = ((a_pinsHandle.pinMask & (~a_pinsValue)) << GPIO_BSRR_RESET_SHIFT) | (a_pinsHandle.pinMask & a_pinsValue);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_togglePinFast
+ * [Description]   : Toggle the logic of a specific pin, the new logic is written to BSRR so the other pins of the port
+ *                   are never rewritten even if an interrupt changes them between the read and the write.
+ * [Arguments]     : <a_pinHandle>   -> Indicates to the handle of the required pin [GPIO_PIN_HANDLE].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static inline void GPIO_togglePinFast(GPIO_pinHandleType a_pinHandle)
+{
+    uint32 LOC_pinOutput = GPIO_HANDLE_REGISTER(a_pinHandle,GPIO_ODR_OFFSET) & a_pinHandle.pinMask;
+    GPIO_HANDLE_REGISTER(a_pinHandle,GPIO_BSRR_OFFSET) = (LOC_pinOutput << GPIO_BSRR_RESET_SHIFT) | (LOC_pinOutput ^ a_pinHandle.pinMask);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_readPinFast
+ * [Description]   : Read the logic of a specific pin [High - LOW] with a single load from IDR, the handle is not
+ *                   validated.
+ * [Arguments]     : <a_pinHandle>   -> Indicates to the handle of the required pin [GPIO_PIN_HANDLE].
+ * [return]        : The function returns the logic of the pin [High - Low].
+ ====================================================================================================================*/
+static inline GPIO_pinStatusType GPIO_readPinFast(GPIO_pinHandleType a_pinHandle)
+{
+    return ((GPIO_HANDLE_REGISTER(a_pinHandle,GPIO_IDR_OFFSET) & a_pinHandle.pinMask) != 0) ? GPIO_HIGH_PIN : GPIO_LOW_PIN;
+}
+
 #endif /* MCAL_GPIO_INCLUDES_GPIO_H_ */
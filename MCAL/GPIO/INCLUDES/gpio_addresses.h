@@ -0,0 +1,33 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : GPIO
+File Name    : gpio_addresses.h
+Date Created : Oct 17, 2026
+Description  : Addresses file for the STM32F401xx GPIO peripheral driver.
+=======================================================================================================================
+*/
+
+
+#ifndef MCAL_GPIO_INCLUDES_GPIO_ADDRESSES_H_
+#define MCAL_GPIO_INCLUDES_GPIO_ADDRESSES_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* All GPIO ports base addresses, shared by the registers structures, the inline fast path functions and EXTI. */
+#define GPIO_PORTA_BASE_ADDRESS          (0X40020000UL)
+#define GPIO_PORTB_BASE_ADDRESS          (0X40020400UL)
+#define GPIO_PORTC_BASE_ADDRESS          (0X40020800UL)
+#define GPIO_PORTD_BASE_ADDRESS          (0X40020C00UL)
+#define GPIO_PORTE_BASE_ADDRESS          (0X40021000UL)
+#define GPIO_PORTH_BASE_ADDRESS          (0X40021C00UL)
+#define GPIO_PORT_ADDRESS_STEP           (0X400UL)
+
+/* The offsets of the data registers from the base address of their port. */
+#define GPIO_IDR_OFFSET                  (0X10UL)
+#define GPIO_ODR_OFFSET                  (0X14UL)
+#define GPIO_BSRR_OFFSET                 (0X18UL)
+
+#endif /* MCAL_GPIO_INCLUDES_GPIO_ADDRESSES_H_ */
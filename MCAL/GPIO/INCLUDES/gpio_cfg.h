@@ -16,6 +16,27 @@ Description  : Configuration file for the STM32F401xx GPIO peripheral driver.
                                 < Definitions and Static Configurations >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+Add an entry for every pin configured by GPIO_init in the static pins table with this format:
+GPIO_PIN(PORT,<Port ID>,<Pin ID>,<Pin Mode>,<Pin Speed>,<Alternate Function>) \
+The first argument [PORT] is written as it is in every entry, it is used to compose the registers values of each port.
+Example: GPIO_PIN(PORT,GPIO_PORTA_ID,GPIO_PIN09_ID,GPIO_ALTERNATE_PUSH_PULL_MODE,GPIO_HIGH_SPEED,GPIO_ALTERNATE_FUNCTION_07) \
+The speed is used only in the output and alternate modes, and the alternate function only in the alternate modes.
+The pins that are not in the table keep their reset configurations, and a pin added twice fails the build.
+The clocks of the used ports must be enabled before GPIO_init.
+=====================================================================================================================*/
+#define GPIO_STATIC_PINS_TABLE(GPIO_PIN,PORT)                                                                          \
+
+/*=====================================================================================================================
+Set the DMA burst of the waveform engine with one of these options: 1- GPIO_WAVEFORM_DMA_DISABLED
+                                                                     2- GPIO_WAVEFORM_DMA_ENABLED
+In the DMA mode, the waveform words are copied to BSRR by a DMA2 memory-to-memory stream as fast as the bus allows,
+so the steps have no fixed cadence. The DMA2 clock must be enabled by the application, and the end of the burst is
+reported by the call-back function of the stream [DMA_setCallBackFunction] if its interrupt is enabled.
+=====================================================================================================================*/
+#define GPIO_WAVEFORM_DMA_STATUS             (GPIO_WAVEFORM_DMA_DISABLED)
 
+/* Set the DMA2 stream used by the waveform DMA burst [DMA_STREAM0_ID ~ DMA_STREAM7_ID]. */
+#define GPIO_WAVEFORM_DMA_STREAM             (DMA_STREAM0_ID)
 
 #endif /* MCAL_GPIO_INCLUDES_GPIO_CFG_H_ */
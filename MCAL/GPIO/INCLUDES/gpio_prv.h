@@ -12,6 +12,12 @@ Description  : Private file for the STM32F401xx GPIO peripheral driver.
 #ifndef MCAL_GPIO_INCLUDES_GPIO_PRV_H_
 #define MCAL_GPIO_INCLUDES_GPIO_PRV_H_
 
+/*=====================================================================================================================
+                                               < Includes >
+=====================================================================================================================*/
+
+#include "gpio_addresses.h"
+
 /*=====================================================================================================================
                                 < Definitions and Static Configurations >
 =====================================================================================================================*/
@@ -20,6 +26,10 @@ Description  : Private file for the STM32F401xx GPIO peripheral driver.
 #define GPIO_NUM_OF_PINS_PER_PORT                    (16U)     /* The number of pins in each port. */
 #define GPIO_HALF_PORT_THRESHOLD                     (8U)      /* The number of the threshold bit. */
 
+/* The DMA burst options of the waveform engine [Disabled - Enabled]. */
+#define GPIO_WAVEFORM_DMA_DISABLED                   (0U)
+#define GPIO_WAVEFORM_DMA_ENABLED                    (1U)
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
@@ -38,17 +48,33 @@ typedef struct
     volatile uint32 AFRH;        /* GPIO alternate function high register. */
 }GPIOx_registersType;
 
+typedef struct
+{
+    uint32 modeMask;             /* The MODER bits of the configured pins.   */
+    uint32 modeValue;            /* The MODER value of the configured pins.  */
+    uint32 typeMask;             /* The OTYPER bits of the configured pins.  */
+    uint32 typeValue;            /* The OTYPER value of the configured pins. */
+    uint32 speedMask;            /* The OSPEEDR bits of the configured pins. */
+    uint32 speedValue;           /* The OSPEEDR value of the configured pins.*/
+    uint32 pullMask;             /* The PUPDR bits of the configured pins.   */
+    uint32 pullValue;            /* The PUPDR value of the configured pins.  */
+    uint32 functionLowMask;      /* The AFRL bits of the configured pins.    */
+    uint32 functionLowValue;     /* The AFRL value of the configured pins.   */
+    uint32 functionHighMask;     /* The AFRH bits of the configured pins.    */
+    uint32 functionHighValue;    /* The AFRH value of the configured pins.   */
+}GPIO_portImageType;             /* The configuration registers values composed for one port. */
+
 /*=====================================================================================================================
                                 < Peripheral Registers and Bits Definitions >
 =====================================================================================================================*/
 
 /* All GPIO peripherals base addresss. */
-#define GPIOA                    ((volatile GPIOx_registersType*)0X40020000)
-#define GPIOB                    ((volatile GPIOx_registersType*)0X40020400)
-#define GPIOC                    ((volatile GPIOx_registersType*)0X40020800)
-#define GPIOD                    ((volatile GPIOx_registersType*)0X40020C00)
-#define GPIOE                    ((volatile GPIOx_registersType*)0X40021000)
-#define GPIOH                    ((volatile GPIOx_registersType*)0X40021C00)
+#define GPIOA                    ((volatile GPIOx_registersType*)GPIO_PORTA_BASE_ADDRESS)
+#define GPIOB                    ((volatile GPIOx_registersType*)GPIO_PORTB_BASE_ADDRESS)
+#define GPIOC                    ((volatile GPIOx_registersType*)GPIO_PORTC_BASE_ADDRESS)
+#define GPIOD                    ((volatile GPIOx_registersType*)GPIO_PORTD_BASE_ADDRESS)
+#define GPIOE                    ((volatile GPIOx_registersType*)GPIO_PORTE_BASE_ADDRESS)
+#define GPIOH                    ((volatile GPIOx_registersType*)GPIO_PORTH_BASE_ADDRESS)
 
 /*=====================================================================================================================
                                          < Function-like Macros >
@@ -58,4 +84,75 @@ typedef struct
 #define GPIO_WRITE_TWO_BITS(REG,PIN,VALUE)  (REG = (REG & (~(0X03 << (PIN * 2)))) | ((VALUE & 0X03) << (PIN * 2)))
 #define GPIO_WRITE_FOUR_BITS(REG,PIN,VALUE) (REG = (REG & (~(0X0F << (PIN * 4)))) | ((VALUE & 0X0F) << (PIN * 4)))
 
+/* Add the two bits of a specific pin with a specific value to a composed register mask and value. */
+#define GPIO_ADD_TWO_BITS(MASK,VALUE,PIN,FIELD) do{(MASK) |= (0X03UL << ((PIN) * 2U)); (VALUE) |= (((uint32)(FIELD) & 0X03UL) << ((PIN) * 2U));}while(0)
+
+/* Write the composed bits of a register with one read-modify-write, the register is not accessed if no bits are composed. */
+#define GPIO_WRITE_MASKED(REG,MASK,VALUE) do{if((MASK) != 0) (REG) = (((REG) & (~(MASK))) | (VALUE));}while(0)
+
+/* Get the BSRR word that writes a specific value on the pins of a specific mask [set bits in the low half and reset
+ * bits in the high half], the other pins are not affected. */
+#define GPIO_GET_BSRR_VALUE(MASK,VALUE)   ((((uint32)(MASK) & (~(uint32)(VALUE))) << GPIO_NUM_OF_PINS_PER_PORT) | ((uint32)(MASK) & (uint32)(VALUE)))
+
+/* Get the lowest set pin of a pins mask by counting the trailing zeros [RBIT and CLZ on Cortex-M4]. */
+#define GPIO_GET_LOWEST_PIN(MASK)         ((uint8)__builtin_ctz(MASK))
+
+/* The classes of the pin modes, the two low bits of a mode are its MODER value. */
+#define GPIO_IS_INPUT_MODE(MODE)      (((MODE) & 0X03UL) == 0X00UL)
+#define GPIO_IS_OUTPUT_MODE(MODE)     ((((MODE) & 0X03UL) == 0X01UL) || (((MODE) & 0X03UL) == 0X02UL))
+#define GPIO_IS_ALTERNATE_MODE(MODE)  (((MODE) & 0X03UL) == 0X02UL)
+
+/* The alternate function register of a pin in the alternate modes [AFRL: Pins 0 ~ 7 - AFRH: Pins 8 ~ 15], and the
+ * position of its four bits in that register. */
+#define GPIO_IS_AFRL_PIN(MODE,PIN)    (GPIO_IS_ALTERNATE_MODE(MODE) && ((PIN) < GPIO_HALF_PORT_THRESHOLD))
+#define GPIO_IS_AFRH_PIN(MODE,PIN)    (GPIO_IS_ALTERNATE_MODE(MODE) && ((PIN) >= GPIO_HALF_PORT_THRESHOLD))
+#define GPIO_GET_AF_SHIFT(PIN)        (((PIN) % GPIO_HALF_PORT_THRESHOLD) * 4U)
+
+/* Get the bits of a static pin field in the registers of a specific port, they are zero for the pins of other ports. */
+#define GPIO_STATIC_FIELD(PORT,PORT_ID,CONDITION,VALUE,SHIFT) ((((PORT_ID) == (PORT)) && (CONDITION)) ? ((uint32)(VALUE) << (SHIFT)) : 0UL)
+
+/* The static pins table entries expanders, every entry adds its fields to the registers of its own port. */
+#define GPIO_STATIC_MODE_MASK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)          | GPIO_STATIC_FIELD(PORT,PORT_ID,1,0X03UL,((PIN_ID) * 2U))
+#define GPIO_STATIC_MODE_VALUE(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)         | GPIO_STATIC_FIELD(PORT,PORT_ID,1,((MODE) & 0X03UL),((PIN_ID) * 2U))
+#define GPIO_STATIC_TYPE_MASK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)          | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_OUTPUT_MODE(MODE),0X01UL,(PIN_ID))
+#define GPIO_STATIC_TYPE_VALUE(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)         | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_OUTPUT_MODE(MODE),(((MODE) >> 0X02) & 0X01UL),(PIN_ID))
+#define GPIO_STATIC_SPEED_MASK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)         | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_OUTPUT_MODE(MODE),0X03UL,((PIN_ID) * 2U))
+#define GPIO_STATIC_SPEED_VALUE(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)        | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_OUTPUT_MODE(MODE),((SPEED) & 0X03UL),((PIN_ID) * 2U))
+#define GPIO_STATIC_PULL_MASK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)          | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_INPUT_MODE(MODE),0X03UL,((PIN_ID) * 2U))
+#define GPIO_STATIC_PULL_VALUE(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)         | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_INPUT_MODE(MODE),(((MODE) >> 0X02) & 0X03UL),((PIN_ID) * 2U))
+#define GPIO_STATIC_FUNCTION_LOW_MASK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)  | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_AFRL_PIN(MODE,PIN_ID),0X0FUL,GPIO_GET_AF_SHIFT(PIN_ID))
+#define GPIO_STATIC_FUNCTION_LOW_VALUE(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION) | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_AFRL_PIN(MODE,PIN_ID),((FUNCTION) & 0X0FUL),GPIO_GET_AF_SHIFT(PIN_ID))
+#define GPIO_STATIC_FUNCTION_HIGH_MASK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION) | GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_AFRH_PIN(MODE,PIN_ID),0X0FUL,GPIO_GET_AF_SHIFT(PIN_ID))
+#define GPIO_STATIC_FUNCTION_HIGH_VALUE(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)| GPIO_STATIC_FIELD(PORT,PORT_ID,GPIO_IS_AFRH_PIN(MODE,PIN_ID),((FUNCTION) & 0X0FUL),GPIO_GET_AF_SHIFT(PIN_ID))
+
+/* The pins of a specific port in the static pins table as a set and as a sum, they differ only if a pin is repeated. */
+#define GPIO_STATIC_PINS_SET(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)           | GPIO_STATIC_FIELD(PORT,PORT_ID,1,0X01UL,(PIN_ID))
+#define GPIO_STATIC_PINS_SUM(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)           + GPIO_STATIC_FIELD(PORT,PORT_ID,1,0X01UL,(PIN_ID))
+
+/* Check the fields of a static pins table entry at build time. */
+#define GPIO_STATIC_PIN_CHECK(PORT,PORT_ID,PIN_ID,MODE,SPEED,FUNCTION)                                                  \
+    _Static_assert((((PORT_ID) >= GPIO_PORTA_ID) && ((PORT_ID) <= GPIO_PORTH_ID)), "Wrong static pin port ID.");      \
+    _Static_assert((((PIN_ID) >= GPIO_PIN00_ID) && ((PIN_ID) <= GPIO_PIN15_ID)), "Wrong static pin ID.");              \
+    _Static_assert(((((MODE) >= GPIO_INPUT_FLOAT_MODE) && ((MODE) <= GPIO_ALTERNATE_OPEN_DRAIN_MODE)) ||                \
+                    ((MODE) == GPIO_INPUT_PULLDOWN_MODE)), "Wrong static pin mode.");                                  \
+    _Static_assert((((SPEED) >= GPIO_LOW_SPEED) && ((SPEED) <= GPIO_VERY_HIGH_SPEED)), "Wrong static pin speed.");    \
+    _Static_assert((((FUNCTION) >= GPIO_ALTERNATE_FUNCTION_00) && ((FUNCTION) <= GPIO_ALTERNATE_FUNCTION_15)),         \
+                   "Wrong static pin alternate function.");
+
+/* Check that no pin of a specific port is repeated in the static pins table at build time. */
+#define GPIO_STATIC_PORT_CHECK(PORT)                                                                                   \
+    _Static_assert(((0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_PINS_SET,PORT)) == (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_PINS_SUM,PORT))), \
+                   "A pin is repeated in the static pins table.")
+
+/* Compose the configuration registers values of a specific port from the static pins table. */
+#define GPIO_STATIC_PORT_IMAGE(PORT)                                                                                   \
+{                                                                                                                      \
+    (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_MODE_MASK,PORT)),(0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_MODE_VALUE,PORT)),          \
+    (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_TYPE_MASK,PORT)),(0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_TYPE_VALUE,PORT)),          \
+    (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_SPEED_MASK,PORT)),(0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_SPEED_VALUE,PORT)),        \
+    (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_PULL_MASK,PORT)),(0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_PULL_VALUE,PORT)),          \
+    (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_FUNCTION_LOW_MASK,PORT)),(0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_FUNCTION_LOW_VALUE,PORT)),   \
+    (0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_FUNCTION_HIGH_MASK,PORT)),(0UL GPIO_STATIC_PINS_TABLE(GPIO_STATIC_FUNCTION_HIGH_VALUE,PORT)), \
+}
+
 #endif /* MCAL_GPIO_INCLUDES_GPIO_PRV_H_ */
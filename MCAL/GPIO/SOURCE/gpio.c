@@ -15,14 +15,60 @@ Description  : Source file for the STM32F401xx GPIO peripheral driver.
 
 #include "../../../OTHERS/std_types.h"
 #include "../../../OTHERS/common_macros.h"
+#include "../../../OTHERS/bit_banding.h"
 #include "../INCLUDES/gpio_prv.h"
 #include "../INCLUDES/gpio_cfg.h"
 #include "../INCLUDES/gpio.h"
+#include "../../DWT/INCLUDES/dwt.h"
+#include "../../DMA/INCLUDES/dma.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* Check the static pins table at build time. */
+GPIO_STATIC_PINS_TABLE(GPIO_STATIC_PIN_CHECK,0)
+GPIO_STATIC_PORT_CHECK(GPIO_PORTA_ID);
+GPIO_STATIC_PORT_CHECK(GPIO_PORTB_ID);
+GPIO_STATIC_PORT_CHECK(GPIO_PORTC_ID);
+GPIO_STATIC_PORT_CHECK(GPIO_PORTD_ID);
+GPIO_STATIC_PORT_CHECK(GPIO_PORTE_ID);
+GPIO_STATIC_PORT_CHECK(GPIO_PORTH_ID);
+
+/* The configuration registers values of all the ports, composed from the static pins table at build time. */
+static const GPIO_portImageType G_staticPortsImages[GPIO_NUM_OF_PORTS] =
+{
+    GPIO_STATIC_PORT_IMAGE(GPIO_PORTA_ID),
+    GPIO_STATIC_PORT_IMAGE(GPIO_PORTB_ID),
+    GPIO_STATIC_PORT_IMAGE(GPIO_PORTC_ID),
+    GPIO_STATIC_PORT_IMAGE(GPIO_PORTD_ID),
+    GPIO_STATIC_PORT_IMAGE(GPIO_PORTE_ID),
+    GPIO_STATIC_PORT_IMAGE(GPIO_PORTH_ID),
+};
 
 /*=====================================================================================================================
                                           < Functions Definitions >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePortImage
+ * [Description]   : Write the composed configuration registers values of a specific port, every used register is
+ *                   written with one read-modify-write and the mode is written last so the pins switch to their modes
+ *                   with the final output type, speed, pull resistors and alternate function.
+ * [Arguments]     : <a_ptr2port>            -> Pointer to the registers of the required port.
+ *                   <a_ptr2image>           -> Pointer to the composed registers values of the port.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void GPIO_writePortImage(GPIOx_registersType* a_ptr2port, const GPIO_portImageType* a_ptr2image)
+{
+    GPIO_WRITE_MASKED(a_ptr2port->PUPDR,a_ptr2image->pullMask,a_ptr2image->pullValue);
+    GPIO_WRITE_MASKED(a_ptr2port->OTYPER,a_ptr2image->typeMask,a_ptr2image->typeValue);
+    GPIO_WRITE_MASKED(a_ptr2port->OSPEEDR,a_ptr2image->speedMask,a_ptr2image->speedValue);
+    GPIO_WRITE_MASKED(a_ptr2port->AFRL,a_ptr2image->functionLowMask,a_ptr2image->functionLowValue);
+    GPIO_WRITE_MASKED(a_ptr2port->AFRH,a_ptr2image->functionHighMask,a_ptr2image->functionHighValue);
+    GPIO_WRITE_MASKED(a_ptr2port->MODER,a_ptr2image->modeMask,a_ptr2image->modeValue);
+}
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_init
  * [Description]   : Initialize all the pins with specific static configurations.
@@ -31,32 +77,30 @@ Description  : Source file for the STM32F401xx GPIO peripheral driver.
  ====================================================================================================================*/
 void GPIO_init(void)
 {
-    /* For Future Work. */
-    /* Goal: Configure all the pins using static configurations during preprocessing stage. */
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+
+    /* The registers values are composed at build time, so only the registers of the used ports are written. */
+    for(uint8 LOC_port = GPIO_PORTA_ID; LOC_port < GPIO_NUM_OF_PORTS; LOC_port++)
+    {
+        GPIO_writePortImage(*(LOC_ptr2GPIOx + LOC_port),(G_staticPortsImages + LOC_port));
+    }
 }
 
 /*=====================================================================================================================
- * [Function Name] : GPIO_configurePin
- * [Description]   : Configure a specific GPIO pin with specific configurations.
+ * [Function Name] : GPIO_checkPinConfigurations
+ * [Description]   : Check the configurations of a specific pin.
  * [Arguments]     : <a_ptr2configurations>      -> Pointer to a structure that holds the configurations.
  * [return]        : The function returns the error status: - No Errors.
- *                                                          - Null Pointer Error.
  *                                                          - Port ID Error.
  *                                                          - Pin ID Error.
  *                                                          - Speed Error.
  *                                                          - Mode Error.
  ====================================================================================================================*/
-GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configurations)
+static GPIO_errorStatusType GPIO_checkPinConfigurations(const GPIO_pinConfigurationsType* a_ptr2configurations)
 {
     GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
-    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
-
-    if(a_ptr2configurations == NULL_PTR)
-    {
-        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
-    }
 
-    else if((a_ptr2configurations->portID < GPIO_PORTA_ID) || (a_ptr2configurations->portID > GPIO_PORTH_ID))
+    if((a_ptr2configurations->portID < GPIO_PORTA_ID) || (a_ptr2configurations->portID > GPIO_PORTH_ID))
     {
         LOC_errorStatus = GPIO_PORT_ID_ERROR;
     }
@@ -66,7 +110,7 @@ GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configu
         LOC_errorStatus = GPIO_PIN_ID_ERROR;
     }
 
-    else if((a_ptr2configurations->pinMode < GPIO_INPUT_FLOAT_MODE) || (a_ptr2configurations->pinMode > GPIO_ALTERNATE_OPEN_DRAIN_MODE) && (a_ptr2configurations->pinMode != GPIO_INPUT_PULLDOWN_MODE))
+    else if(((a_ptr2configurations->pinMode < GPIO_INPUT_FLOAT_MODE) || (a_ptr2configurations->pinMode > GPIO_ALTERNATE_OPEN_DRAIN_MODE)) && (a_ptr2configurations->pinMode != GPIO_INPUT_PULLDOWN_MODE))
     {
         LOC_errorStatus = GPIO_PIN_MODE_ERROR;
     }
@@ -77,6 +121,40 @@ GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configu
     }
 
     else
+    {
+        /* Do Nothing, the configurations are valid. */
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_configurePin
+ * [Description]   : Configure a specific GPIO pin with specific configurations.
+ * [Arguments]     : <a_ptr2configurations>      -> Pointer to a structure that holds the configurations.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ *                                                          - Speed Error.
+ *                                                          - Mode Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configurations)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+
+    if(a_ptr2configurations == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        LOC_errorStatus = GPIO_checkPinConfigurations(a_ptr2configurations);
+    }
+
+    if(LOC_errorStatus == GPIO_NO_ERRORS)
     {
         /* Set the I/O mode for the required pin [Input - Output - Alternate Function - Analog]. */
         GPIO_WRITE_TWO_BITS((*(LOC_ptr2GPIOx + a_ptr2configurations->portID))->MODER,a_ptr2configurations->pinID,a_ptr2configurations->pinMode);
@@ -94,8 +172,8 @@ GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configu
         case GPIO_OUTPUT_OPEN_DRAIN_MODE:
         case GPIO_ALTERNATE_PUSH_PULL_MODE:
         case GPIO_ALTERNATE_OPEN_DRAIN_MODE:
-            /* In case of output mode, Set the output type for the required pin [Push-Pull - Open-Drain]. */
-            GPIO_WRITE_TWO_BITS((*(LOC_ptr2GPIOx + a_ptr2configurations->portID))->OTYPER,a_ptr2configurations->pinID,(a_ptr2configurations->pinMode >> 0X02));
+            /* In case of output mode, Set the output type for the required pin [Push-Pull - Open-Drain] [one bit per pin]. */
+            WRITE_BIT((*(LOC_ptr2GPIOx + a_ptr2configurations->portID))->OTYPER,a_ptr2configurations->pinID,(a_ptr2configurations->pinMode >> 0X02));
             /* In case of output mode, Set the output speed for the required pin [Low - Medium - High - Very High]. */
             GPIO_WRITE_TWO_BITS((*(LOC_ptr2GPIOx + a_ptr2configurations->portID))->OSPEEDR,a_ptr2configurations->pinID,a_ptr2configurations->pinSpeed);
             break;
@@ -113,6 +191,108 @@ GPIO_errorStatusType GPIO_configurePin(GPIO_pinConfigurationsType* a_ptr2configu
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_configurePins
+ * [Description]   : Configure multiple GPIO pins on any ports, the registers values are composed for every port so each
+ *                   configuration register is written once per port. No pin is configured if any configuration is
+ *                   wrong or repeated in the array.
+ * [Arguments]     : <a_ptr2configurations>      -> Pointer to an array of structures that hold the configurations.
+ *                   <a_numberOfPins>            -> Indicates to the number of the configurations in the array.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ *                                                          - Speed Error.
+ *                                                          - Mode Error.
+ *                                                          - Repeated Pin Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_configurePins(const GPIO_pinConfigurationsType* a_ptr2configurations, uint8 a_numberOfPins)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+    GPIO_portImageType LOC_portsImages[GPIO_NUM_OF_PORTS] = {{0}};
+    uint16 LOC_portsPins[GPIO_NUM_OF_PORTS] = {0};
+    const GPIO_pinConfigurationsType* LOC_ptr2pin = NULL_PTR;
+    GPIO_portImageType* LOC_ptr2image = NULL_PTR;
+
+    if(a_ptr2configurations == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* Check all the configurations first, so the pins are configured all together or not at all. A repeated pin
+         * is rejected, because its fields would be merged with the fields of its first configuration. */
+        for(uint8 LOC_index = 0; (LOC_index < a_numberOfPins) && (LOC_errorStatus == GPIO_NO_ERRORS); LOC_index++)
+        {
+            LOC_ptr2pin = (a_ptr2configurations + LOC_index);
+            LOC_errorStatus = GPIO_checkPinConfigurations(LOC_ptr2pin);
+
+            if(LOC_errorStatus != GPIO_NO_ERRORS)
+            {
+                /* Do Nothing, the loop ends with the error status. */
+            }
+
+            else if(BIT_IS_SET(*(LOC_portsPins + LOC_ptr2pin->portID),LOC_ptr2pin->pinID))
+            {
+                LOC_errorStatus = GPIO_REPEATED_PIN_ERROR;
+            }
+
+            else
+            {
+                SET_BIT(*(LOC_portsPins + LOC_ptr2pin->portID),LOC_ptr2pin->pinID);
+            }
+        }
+    }
+
+    if(LOC_errorStatus == GPIO_NO_ERRORS)
+    {
+        /* Compose the configuration registers values of every port with the same fields of GPIO_configurePin. */
+        for(uint8 LOC_index = 0; LOC_index < a_numberOfPins; LOC_index++)
+        {
+            LOC_ptr2pin = (a_ptr2configurations + LOC_index);
+            LOC_ptr2image = (LOC_portsImages + LOC_ptr2pin->portID);
+
+            GPIO_ADD_TWO_BITS(LOC_ptr2image->modeMask,LOC_ptr2image->modeValue,LOC_ptr2pin->pinID,LOC_ptr2pin->pinMode);
+
+            switch (LOC_ptr2pin->pinMode)
+            {
+            case GPIO_INPUT_FLOAT_MODE:
+            case GPIO_INPUT_PULLUP_MODE:
+            case GPIO_INPUT_PULLDOWN_MODE:
+                GPIO_ADD_TWO_BITS(LOC_ptr2image->pullMask,LOC_ptr2image->pullValue,LOC_ptr2pin->pinID,(LOC_ptr2pin->pinMode >> 0X02));
+                break;
+            
+            case GPIO_OUTPUT_PUSH_PULL_MODE:
+            case GPIO_OUTPUT_OPEN_DRAIN_MODE:
+            case GPIO_ALTERNATE_PUSH_PULL_MODE:
+            case GPIO_ALTERNATE_OPEN_DRAIN_MODE:
+                LOC_ptr2image->typeMask |= (0X01UL << LOC_ptr2pin->pinID);
+                LOC_ptr2image->typeValue |= (((uint32)LOC_ptr2pin->pinMode >> 0X02) << LOC_ptr2pin->pinID);
+                GPIO_ADD_TWO_BITS(LOC_ptr2image->speedMask,LOC_ptr2image->speedValue,LOC_ptr2pin->pinID,LOC_ptr2pin->pinSpeed);
+                break;
+            
+            case GPIO_ANALOG_MODE:
+                /* Do Nothing. */
+                break;
+            
+            default:
+                /* Do Nothing. */
+                break;
+            }
+        }
+
+        /* Write every configuration register of the used ports once. */
+        for(uint8 LOC_port = GPIO_PORTA_ID; LOC_port < GPIO_NUM_OF_PORTS; LOC_port++)
+        {
+            GPIO_writePortImage(*(LOC_ptr2GPIOx + LOC_port),(LOC_portsImages + LOC_port));
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_writePin
  * [Description]   : Write a specific logic [High or Low] on a specific pin.
@@ -129,6 +309,8 @@ GPIO_errorStatusType GPIO_writePin(GPIO_portIDType a_portID, GPIO_pinIDType a_pi
     GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
     GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
 
+    DWT_BEGIN_PROBE(DWT_GPIO_WRITE_PIN_PROBE);
+
     if((a_portID < GPIO_PORTA_ID) || (a_portID > GPIO_PORTH_ID))
     {
         LOC_errorStatus = GPIO_PORT_ID_ERROR;
@@ -147,9 +329,11 @@ GPIO_errorStatusType GPIO_writePin(GPIO_portIDType a_portID, GPIO_pinIDType a_pi
     else
     {
         /* Write the corresponding bit for this pin in the ODR register with the required status. */
-        WRITE_BIT((*(LOC_ptr2GPIOx + a_portID))->ODR,a_pinID,a_pinStatus);
+        BIT_BAND_WRITE_BIT((*(LOC_ptr2GPIOx + a_portID))->ODR,a_pinID,a_pinStatus);
     }
 
+    DWT_END_PROBE(DWT_GPIO_WRITE_PIN_PROBE);
+
     return LOC_errorStatus;
 }
 
@@ -234,6 +418,221 @@ GPIO_errorStatusType GPIO_writePort(GPIO_portIDType a_portID, uint16 a_portValue
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePortMasked
+ * [Description]   : Write a specific value on a group of pins of a certain port with a single atomic store to BSRR,
+ *                   the other pins of the port are not affected.
+ * [Arguments]     : <a_portID>      -> Indicates to the required port ID.
+ *                   <a_pinsMask>    -> Indicates to the pins to be written [bit n: Pin n].
+ *                   <a_pinsValue>   -> Indicates to the logic of the written pins [bit n: Pin n].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_writePortMasked(GPIO_portIDType a_portID, uint16 a_pinsMask, uint16 a_pinsValue)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+
+    if((a_portID < GPIO_PORTA_ID) || (a_portID > GPIO_PORTH_ID))
+    {
+        LOC_errorStatus = GPIO_PORT_ID_ERROR;
+    }
+
+    else
+    {
+        /* Set the High pins and reset the Low pins of the mask in one store. */
+        (*(LOC_ptr2GPIOx + a_portID))->BSRR = GPIO_GET_BSRR_VALUE(a_pinsMask,a_pinsValue);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_writePortsMasked
+ * [Description]   : Write specific values on groups of pins of multiple ports, the writes of the same port are merged
+ *                   and every used port is written with one BSRR store. The stores are issued back to back with the
+ *                   interrupts disabled, so the ports are updated within a few cycles of each other. No port is
+ *                   written if any port ID is wrong or if two writes of the same port share a pin.
+ * [Arguments]     : <a_ptr2writes>        -> Pointer to an array of structures that hold the masked writes.
+ *                   <a_numberOfWrites>    -> Indicates to the number of the writes in the array.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Repeated Pin Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_writePortsMasked(const GPIO_portWriteType* a_ptr2writes, uint8 a_numberOfWrites)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+    uint32 LOC_portsWords[GPIO_NUM_OF_PORTS] = {0};
+    uint16 LOC_portsMasks[GPIO_NUM_OF_PORTS] = {0};
+    uint32 LOC_interruptsState = 0;
+
+    if(a_ptr2writes == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* Compose the BSRR word of every port, so the ports are written all together or not at all. */
+        for(uint8 LOC_index = 0; (LOC_index < a_numberOfWrites) && (LOC_errorStatus == GPIO_NO_ERRORS); LOC_index++)
+        {
+            if(((a_ptr2writes + LOC_index)->portID < GPIO_PORTA_ID) || ((a_ptr2writes + LOC_index)->portID > GPIO_PORTH_ID))
+            {
+                LOC_errorStatus = GPIO_PORT_ID_ERROR;
+            }
+
+            /* A pin written twice would have both its set and reset bits in the merged word, and the set bit wins. */
+            else if(*(LOC_portsMasks + (a_ptr2writes + LOC_index)->portID) & (a_ptr2writes + LOC_index)->pinsMask)
+            {
+                LOC_errorStatus = GPIO_REPEATED_PIN_ERROR;
+            }
+
+            else
+            {
+                *(LOC_portsMasks + (a_ptr2writes + LOC_index)->portID) |= (a_ptr2writes + LOC_index)->pinsMask;
+                *(LOC_portsWords + (a_ptr2writes + LOC_index)->portID) |= GPIO_GET_BSRR_VALUE((a_ptr2writes + LOC_index)->pinsMask,(a_ptr2writes + LOC_index)->pinsValue);
+            }
+        }
+    }
+
+    if(LOC_errorStatus == GPIO_NO_ERRORS)
+    {
+        /* Write the used ports back to back, so no interrupt handler runs between the updates of the ports. */
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        for(uint8 LOC_port = GPIO_PORTA_ID; LOC_port < GPIO_NUM_OF_PORTS; LOC_port++)
+        {
+            if(*(LOC_portsWords + LOC_port) != 0)
+            {
+                (*(LOC_ptr2GPIOx + LOC_port))->BSRR = *(LOC_portsWords + LOC_port);
+            }
+        }
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_playWaveform
+ * [Description]   : Replay a table of waveform words [GPIO_WAVEFORM_WORD] on a certain port, every word is stored to
+ *                   BSRR at a fixed number of CPU cycles after the previous one. The steps are paced by the DWT cycle
+ *                   counter against absolute deadlines, so the timing errors do not accumulate, and the interrupts are
+ *                   disabled during the replay. A zero step replays the words back to back as fast as the CPU allows.
+ *                   The cycle counter must be enabled by DWT_enableCycleCounter when the step is not zero, and the
+ *                   step must be longer than the loop overhead [about 10 cycles] to be kept.
+ * [Arguments]     : <a_portID>          -> Indicates to the required port ID.
+ *                   <a_ptr2words>       -> Pointer to the array of the waveform words.
+ *                   <a_numberOfWords>   -> Indicates to the number of the words in the array.
+ *                   <a_stepCycles>      -> Indicates to the duration of each step in CPU cycles [0: No pacing].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_playWaveform(GPIO_portIDType a_portID, const uint32* a_ptr2words, uint16 a_numberOfWords, uint32 a_stepCycles)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+    uint32 LOC_interruptsState = 0;
+
+    if(a_ptr2words == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else if((a_portID < GPIO_PORTA_ID) || (a_portID > GPIO_PORTH_ID))
+    {
+        LOC_errorStatus = GPIO_PORT_ID_ERROR;
+    }
+
+    else
+    {
+        volatile uint32* LOC_ptr2BSRR = &((*(LOC_ptr2GPIOx + a_portID))->BSRR);
+        const uint32* LOC_ptr2word = a_ptr2words;
+        const uint32* LOC_ptr2end = (a_ptr2words + a_numberOfWords);
+        uint32 LOC_deadline = 0;
+
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        if(a_stepCycles == 0)
+        {
+            /* Store the words back to back, the loop has nothing but the load and the store. */
+            while(LOC_ptr2word != LOC_ptr2end)
+            {
+                *LOC_ptr2BSRR = *(LOC_ptr2word++);
+            }
+        }
+
+        else
+        {
+            /* Wait for the deadline of every step, then store its word and move the deadline by one step. */
+            LOC_deadline = DWT_getCycleCount();
+            while(LOC_ptr2word != LOC_ptr2end)
+            {
+                while((sint32)(DWT_getCycleCount() - LOC_deadline) < 0);
+                *LOC_ptr2BSRR = *(LOC_ptr2word++);
+                LOC_deadline += a_stepCycles;
+            }
+        }
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+#if(GPIO_WAVEFORM_DMA_STATUS == GPIO_WAVEFORM_DMA_ENABLED)
+/*=====================================================================================================================
+ * [Function Name] : GPIO_startWaveformBurst
+ * [Description]   : Start copying a table of waveform words [GPIO_WAVEFORM_WORD] to the BSRR of a certain port by the
+ *                   configured DMA2 stream, then return without waiting for the end of the burst. The table must stay
+ *                   valid until the end of the burst [GPIO_WAVEFORM_DMA_STATUS must be enabled].
+ * [Arguments]     : <a_portID>          -> Indicates to the required port ID.
+ *                   <a_ptr2words>       -> Pointer to the array of the waveform words.
+ *                   <a_numberOfWords>   -> Indicates to the number of the words in the array.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - DMA Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_startWaveformBurst(GPIO_portIDType a_portID, const uint32* a_ptr2words, uint16 a_numberOfWords)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+
+    /* Only DMA2 performs memory-to-memory transfers, the words are read from the table and written to a fixed BSRR. */
+    DMA_streamConfigurationsType LOC_DMAConfigurations = {DMA2_ID,GPIO_WAVEFORM_DMA_STREAM,DMA_CHANNEL0_ID,DMA_MEMORY_TO_MEMORY,
+                                                          DMA_NORMAL_MODE,DMA_WORD_SIZE,DMA_FIXED_ADDRESS,DMA_INCREMENTED_ADDRESS,
+                                                          DMA_VERY_HIGH_PRIORITY,(DMA_TRANSFER_ERROR_INTERRUPT | DMA_TRANSFER_COMPLETE_INTERRUPT)};
+
+    if(a_ptr2words == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else if((a_portID < GPIO_PORTA_ID) || (a_portID > GPIO_PORTH_ID))
+    {
+        LOC_errorStatus = GPIO_PORT_ID_ERROR;
+    }
+
+    else if(DMA_configureStream(&LOC_DMAConfigurations) != DMA_NO_ERRORS)
+    {
+        LOC_errorStatus = GPIO_DMA_ERROR;
+    }
+
+    else if(DMA_startTransfer(DMA2_ID,GPIO_WAVEFORM_DMA_STREAM,(uint32)a_ptr2words,(uint32)&((*(LOC_ptr2GPIOx + a_portID))->BSRR),a_numberOfWords) != DMA_NO_ERRORS)
+    {
+        LOC_errorStatus = GPIO_DMA_ERROR;
+    }
+
+    else
+    {
+        /* Do Nothing, the burst is started. */
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_readPin
  * [Description]   : Read the logic of a specific pin [High - LOW].
@@ -307,6 +706,278 @@ GPIO_errorStatusType GPIO_readPort(GPIO_portIDType a_portID, uint16* a_ptr2portV
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : GPIO_isAnyPortScanned
+ * [Description]   : Check if a port scanner has scanned pins in any port.
+ * [Arguments]     : <a_ptr2scanner>     -> Pointer to the required port scanner.
+ * [return]        : The function returns TRUE if any port is scanned, otherwise FALSE.
+ ====================================================================================================================*/
+static uint8 GPIO_isAnyPortScanned(const GPIO_scannerType* a_ptr2scanner)
+{
+    uint16 LOC_scannedPins = 0;
+
+    for(uint8 LOC_port = GPIO_PORTA_ID; LOC_port < GPIO_NUM_OF_PORTS; LOC_port++)
+    {
+        LOC_scannedPins |= *(a_ptr2scanner->pinsMasks + LOC_port);
+    }
+
+    return ((LOC_scannedPins != 0) ? TRUE : FALSE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_initScanner
+ * [Description]   : Take the first snapshot of the scanned pins of a port scanner, the pins masks must be set first.
+ * [Arguments]     : <a_ptr2scanner>     -> Pointer to the required port scanner.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_initScanner(GPIO_scannerType* a_ptr2scanner)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+
+    if(a_ptr2scanner == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else if(GPIO_isAnyPortScanned(a_ptr2scanner) == FALSE)
+    {
+        LOC_errorStatus = GPIO_PORT_ID_ERROR;
+    }
+
+    else
+    {
+        for(uint8 LOC_port = GPIO_PORTA_ID; LOC_port < GPIO_NUM_OF_PORTS; LOC_port++)
+        {
+            if(*(a_ptr2scanner->pinsMasks + LOC_port) != 0)
+            {
+                *(a_ptr2scanner->snapshot + LOC_port) = (uint16)((*(LOC_ptr2GPIOx + LOC_port))->IDR & *(a_ptr2scanner->pinsMasks + LOC_port));
+            }
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_scanPorts
+ * [Description]   : Read the input data register of every scanned port once, compare it with the last snapshot and
+ *                   report the changed pins only. If the events array is full, the remaining changes are kept out of
+ *                   the snapshot and reported by the next scan.
+ * [Arguments]     : <a_ptr2scanner>         -> Pointer to the required port scanner.
+ *                   <a_ptr2events>          -> Pointer to an array to store the events of the changed pins.
+ *                   <a_maxEvents>           -> Indicates to the size of the events array.
+ *                   <a_ptr2numberOfEvents>  -> Pointer to variable to store the number of the stored events.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_scanPorts(GPIO_scannerType* a_ptr2scanner, GPIO_pinEventType* a_ptr2events, uint8 a_maxEvents, uint8* a_ptr2numberOfEvents)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+    uint32 LOC_changedPins = 0;
+    uint8 LOC_numberOfEvents = 0;
+    uint8 LOC_pin = GPIO_PIN00_ID;
+
+    if((a_ptr2scanner == NULL_PTR) || (a_ptr2events == NULL_PTR) || (a_ptr2numberOfEvents == NULL_PTR))
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else if(GPIO_isAnyPortScanned(a_ptr2scanner) == FALSE)
+    {
+        LOC_errorStatus = GPIO_PORT_ID_ERROR;
+    }
+
+    else
+    {
+        for(uint8 LOC_port = GPIO_PORTA_ID; LOC_port < GPIO_NUM_OF_PORTS; LOC_port++)
+        {
+            if(*(a_ptr2scanner->pinsMasks + LOC_port) != 0)
+            {
+                /* The changed pins are the scanned bits that differ from the last snapshot. */
+                LOC_changedPins = ((*(LOC_ptr2GPIOx + LOC_port))->IDR ^ *(a_ptr2scanner->snapshot + LOC_port)) & *(a_ptr2scanner->pinsMasks + LOC_port);
+
+                /* Visit only the changed pins, from the lowest set bit, and move each reported pin to its new logic. */
+                while((LOC_changedPins != 0) && (LOC_numberOfEvents < a_maxEvents))
+                {
+                    LOC_pin = GPIO_GET_LOWEST_PIN(LOC_changedPins);
+                    LOC_changedPins &= (LOC_changedPins - 1UL);                         /* Clear the lowest set bit. */
+                    *(a_ptr2scanner->snapshot + LOC_port) ^= (uint16)(1U << LOC_pin);
+
+                    (a_ptr2events + LOC_numberOfEvents)->portID = LOC_port;
+                    (a_ptr2events + LOC_numberOfEvents)->pinID = LOC_pin;
+                    (a_ptr2events + LOC_numberOfEvents)->pinStatus = GET_BIT(*(a_ptr2scanner->snapshot + LOC_port),LOC_pin);
+                    LOC_numberOfEvents++;
+                }
+            }
+        }
+
+        *a_ptr2numberOfEvents = LOC_numberOfEvents;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_checkMatrixConfigurations
+ * [Description]   : Check the ports and the pins of a keys matrix, the rows and the columns on the same port must not
+ *                   share any pin.
+ * [Arguments]     : <a_ptr2matrix>      -> Pointer to the required keys matrix.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ ====================================================================================================================*/
+static GPIO_errorStatusType GPIO_checkMatrixConfigurations(const GPIO_matrixType* a_ptr2matrix)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+
+    if((a_ptr2matrix->rowsPortID < GPIO_PORTA_ID) || (a_ptr2matrix->rowsPortID > GPIO_PORTH_ID) || \
+       (a_ptr2matrix->columnsPortID < GPIO_PORTA_ID) || (a_ptr2matrix->columnsPortID > GPIO_PORTH_ID))
+    {
+        LOC_errorStatus = GPIO_PORT_ID_ERROR;
+    }
+
+    else if((a_ptr2matrix->rowsMask == 0) || (a_ptr2matrix->columnsMask == 0))
+    {
+        LOC_errorStatus = GPIO_PIN_ID_ERROR;
+    }
+
+    else if((a_ptr2matrix->rowsPortID == a_ptr2matrix->columnsPortID) && ((a_ptr2matrix->rowsMask & a_ptr2matrix->columnsMask) != 0))
+    {
+        LOC_errorStatus = GPIO_PIN_ID_ERROR;
+    }
+
+    else
+    {
+        /* Do Nothing, the configurations are valid. */
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_initMatrix
+ * [Description]   : Check the configurations of a keys matrix, drive all its rows High and clear its snapshot, so the
+ *                   keys held at the first scan are reported as pressed.
+ * [Arguments]     : <a_ptr2matrix>      -> Pointer to the required keys matrix.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_initMatrix(GPIO_matrixType* a_ptr2matrix)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+
+    if(a_ptr2matrix == NULL_PTR)
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        LOC_errorStatus = GPIO_checkMatrixConfigurations(a_ptr2matrix);
+    }
+
+    if(LOC_errorStatus == GPIO_NO_ERRORS)
+    {
+        (*(LOC_ptr2GPIOx + a_ptr2matrix->rowsPortID))->BSRR = a_ptr2matrix->rowsMask;
+
+        for(uint8 LOC_row = GPIO_PIN00_ID; LOC_row < GPIO_NUM_OF_PINS_PER_PORT; LOC_row++)
+        {
+            *(a_ptr2matrix->snapshot + LOC_row) = 0;
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : GPIO_scanMatrix
+ * [Description]   : Drive every row of a keys matrix Low with one BSRR store, wait the settle time, read the columns
+ *                   with one IDR read, then report the changed keys only. If the events array is full, the remaining
+ *                   changes are reported by the next scan. The cycle counter must be enabled by DWT_enableCycleCounter
+ *                   when the settle time is not zero.
+ * [Arguments]     : <a_ptr2matrix>          -> Pointer to the required keys matrix.
+ *                   <a_ptr2events>          -> Pointer to an array to store the events of the changed keys.
+ *                   <a_maxEvents>           -> Indicates to the size of the events array.
+ *                   <a_ptr2numberOfEvents>  -> Pointer to variable to store the number of the stored events.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Port ID Error.
+ *                                                          - Pin ID Error.
+ ====================================================================================================================*/
+GPIO_errorStatusType GPIO_scanMatrix(GPIO_matrixType* a_ptr2matrix, GPIO_keyEventType* a_ptr2events, uint8 a_maxEvents, uint8* a_ptr2numberOfEvents)
+{
+    GPIO_errorStatusType LOC_errorStatus = GPIO_NO_ERRORS;
+    GPIOx_registersType* LOC_ptr2GPIOx[GPIO_NUM_OF_PORTS] = {GPIOA,GPIOB,GPIOC,GPIOD,GPIOE,GPIOH};
+    uint32 LOC_remainingRows = 0;
+    uint32 LOC_pressedColumns = 0;
+    uint32 LOC_changedColumns = 0;
+    uint32 LOC_settleStart = 0;
+    uint8 LOC_numberOfEvents = 0;
+    uint8 LOC_row = GPIO_PIN00_ID;
+    uint8 LOC_column = GPIO_PIN00_ID;
+
+    if((a_ptr2matrix == NULL_PTR) || (a_ptr2events == NULL_PTR) || (a_ptr2numberOfEvents == NULL_PTR))
+    {
+        LOC_errorStatus = GPIO_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        LOC_errorStatus = GPIO_checkMatrixConfigurations(a_ptr2matrix);
+    }
+
+    if(LOC_errorStatus == GPIO_NO_ERRORS)
+    {
+        GPIOx_registersType* LOC_ptr2rows = *(LOC_ptr2GPIOx + a_ptr2matrix->rowsPortID);
+        GPIOx_registersType* LOC_ptr2columns = *(LOC_ptr2GPIOx + a_ptr2matrix->columnsPortID);
+        LOC_remainingRows = a_ptr2matrix->rowsMask;
+
+        while(LOC_remainingRows != 0)
+        {
+            LOC_row = GPIO_GET_LOWEST_PIN(LOC_remainingRows);
+            LOC_remainingRows &= (LOC_remainingRows - 1UL);                             /* Clear the lowest set bit. */
+
+            /* Drive the current row Low and the other rows High with one store, then let the columns settle. */
+            LOC_ptr2rows->BSRR = GPIO_GET_BSRR_VALUE(a_ptr2matrix->rowsMask,(a_ptr2matrix->rowsMask & (~(1UL << LOC_row))));
+            if(a_ptr2matrix->settleCycles != 0)
+            {
+                LOC_settleStart = DWT_getCycleCount();
+                while((DWT_getCycleCount() - LOC_settleStart) < a_ptr2matrix->settleCycles);
+            }
+
+            /* A pressed key connects its column to the Low row, so the pressed columns read Low. */
+            LOC_pressedColumns = (~(LOC_ptr2columns->IDR)) & a_ptr2matrix->columnsMask;
+            LOC_changedColumns = LOC_pressedColumns ^ *(a_ptr2matrix->snapshot + LOC_row);
+
+            while((LOC_changedColumns != 0) && (LOC_numberOfEvents < a_maxEvents))
+            {
+                LOC_column = GPIO_GET_LOWEST_PIN(LOC_changedColumns);
+                LOC_changedColumns &= (LOC_changedColumns - 1UL);                       /* Clear the lowest set bit. */
+                *(a_ptr2matrix->snapshot + LOC_row) ^= (uint16)(1U << LOC_column);
+
+                (a_ptr2events + LOC_numberOfEvents)->rowPinID = LOC_row;
+                (a_ptr2events + LOC_numberOfEvents)->columnPinID = LOC_column;
+                (a_ptr2events + LOC_numberOfEvents)->keyStatus = (BIT_IS_SET(LOC_pressedColumns,LOC_column) ? GPIO_LOW_PIN : GPIO_HIGH_PIN);
+                LOC_numberOfEvents++;
+            }
+        }
+
+        /* Release all the rows until the next scan. */
+        LOC_ptr2rows->BSRR = a_ptr2matrix->rowsMask;
+        *a_ptr2numberOfEvents = LOC_numberOfEvents;
+    }
+
+    return LOC_errorStatus;
+}
+
 /*=====================================================================================================================
  * [Function Name] : GPIO_togglePin
  * [Description]   : Toggle the logic of a specific pin.
@@ -334,7 +1005,7 @@ GPIO_errorStatusType GPIO_togglePin(GPIO_portIDType a_portID, GPIO_pinIDType a_p
     else
     {
         /* Toggle the value of the corresponding bit for this pin in the ODR register. */
-        TOGGLE_BIT((*(LOC_ptr2GPIOx + a_portID))->ODR,a_pinID);
+        BIT_BAND_TOGGLE_BIT((*(LOC_ptr2GPIOx + a_portID))->ODR,a_pinID);
     }
 
     return LOC_errorStatus;
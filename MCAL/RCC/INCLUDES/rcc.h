@@ -57,6 +57,17 @@ Description  : Interface file for the STM32F401xx RCC peripheral driver.
 #define RCC_APB2_TIM10_PERIPHERAL           (17UL)
 #define RCC_APB2_TIM11_PERIPHERAL           (18UL)
 
+/* PLL Limits: the VCO input [Input Clock / M] and the VCO output [VCO input * N] frequencies ranges. */
+#define RCC_PLL_VCO_INPUT_MIN_FREQUENCY     (1000000UL)
+#define RCC_PLL_VCO_INPUT_MAX_FREQUENCY     (2000000UL)
+#define RCC_PLL_VCO_OUTPUT_MIN_FREQUENCY    (192000000UL)
+#define RCC_PLL_VCO_OUTPUT_MAX_FREQUENCY    (432000000UL)
+
+/* The maximum system clock frequency and the required USB OTG FS/SDIO clock frequency [VCO output / Q]. */
+#define RCC_SYSTEM_CLOCK_MAX_FREQUENCY      (84000000UL)
+#define RCC_APB1_CLOCK_MAX_FREQUENCY        (42000000UL)
+#define RCC_PLL_USB_CLOCK_FREQUENCY         (48000000UL)
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
@@ -69,6 +80,10 @@ typedef enum
     RCC_PERIPHERAL_BUS_ERROR,             /* Wrong Peripheral Bus Error.                                  */
     RCC_PLL_WRONG_FACTOR_ERROR,           /* Wrong Value for PLL Factor Error.                            */
     RCC_FUNCTION_TIMEOUT_ERROR,           /* Function Timeout Ended Error.                                */
+    RCC_PLL_NO_SOLUTION_ERROR,            /* No PLL Factors Generate the Required Clocks Error.           */
+    RCC_PRESCALER_ERROR,                  /* Wrong Bus Prescaler or APB1 Clock Above 42 MHz Error.        */
+    RCC_FLASH_LATENCY_ERROR,              /* FLASH Wait States Can Not Support the Clock Error.           */
+    RCC_BUSY_ERROR,                       /* Clock Source Bring-up or PLL is Already Running Error.       */
 }RCC_errorStatusType;
 
 typedef enum
@@ -95,16 +110,94 @@ typedef struct
     uint8 Q_division_factor;              /* PLL Q Factor [2 ~ 15].                                       */
 }RCC_PLLConfigurationsType;
 
+typedef enum
+{
+    RCC_AHB_NOT_DIVIDED       = 0X00,     /* AHB Clock = System Clock.                                    */
+    RCC_AHB_DIVIDED_BY_2      = 0X08,     /* AHB Clock = System Clock / 2.                                */
+    RCC_AHB_DIVIDED_BY_4      = 0X09,     /* AHB Clock = System Clock / 4.                                */
+    RCC_AHB_DIVIDED_BY_8      = 0X0A,     /* AHB Clock = System Clock / 8.                                */
+    RCC_AHB_DIVIDED_BY_16     = 0X0B,     /* AHB Clock = System Clock / 16.                               */
+    RCC_AHB_DIVIDED_BY_64     = 0X0C,     /* AHB Clock = System Clock / 64.                               */
+    RCC_AHB_DIVIDED_BY_128    = 0X0D,     /* AHB Clock = System Clock / 128.                              */
+    RCC_AHB_DIVIDED_BY_256    = 0X0E,     /* AHB Clock = System Clock / 256.                              */
+    RCC_AHB_DIVIDED_BY_512    = 0X0F,     /* AHB Clock = System Clock / 512.                              */
+}RCC_AHBPrescalerType;
+
+typedef enum
+{
+    RCC_APB_NOT_DIVIDED       = 0X00,     /* APB Clock = AHB Clock [APB1 Clock must not exceed 42 MHz].   */
+    RCC_APB_DIVIDED_BY_2      = 0X04,     /* APB Clock = AHB Clock / 2.                                   */
+    RCC_APB_DIVIDED_BY_4      = 0X05,     /* APB Clock = AHB Clock / 4.                                   */
+    RCC_APB_DIVIDED_BY_8      = 0X06,     /* APB Clock = AHB Clock / 8.                                   */
+    RCC_APB_DIVIDED_BY_16     = 0X07,     /* APB Clock = AHB Clock / 16.                                  */
+}RCC_APBPrescalerType;
+
+typedef struct
+{
+    uint32 systemClock;                   /* System Clock Frequency [SYSCLK] in Hz.                       */
+    uint32 AHBClock;                      /* AHB Bus Clock Frequency [HCLK] in Hz.                        */
+    uint32 APB1Clock;                     /* APB1 Bus Clock Frequency [PCLK1] in Hz.                      */
+    uint32 APB2Clock;                     /* APB2 Bus Clock Frequency [PCLK2] in Hz.                      */
+}RCC_clockTreeType;
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* The PLL factors for a constant system clock are resolved by the compiler with the VCO input fixed to 1 MHz
+ * [M = Input Clock / 1 MHz], so N equals the VCO output in MHz. The P divider generating a VCO output that is a
+ * multiple of 48 MHz is preferred to keep the USB clock exact, otherwise the smallest valid P divider is used. */
+#define RCC_PLL_STATIC_N_FACTOR(SYSCLK,P)           ((uint32)((((uint64)(SYSCLK) * (P)) + (RCC_PLL_VCO_INPUT_MIN_FREQUENCY / 2UL)) / RCC_PLL_VCO_INPUT_MIN_FREQUENCY))
+
+#define RCC_PLL_STATIC_P_IS_VALID(SYSCLK,P)         ((RCC_PLL_STATIC_N_FACTOR(SYSCLK,P) >= (RCC_PLL_VCO_OUTPUT_MIN_FREQUENCY / RCC_PLL_VCO_INPUT_MIN_FREQUENCY)) && \
+                                                    (RCC_PLL_STATIC_N_FACTOR(SYSCLK,P) <= (RCC_PLL_VCO_OUTPUT_MAX_FREQUENCY / RCC_PLL_VCO_INPUT_MIN_FREQUENCY)))
+
+#define RCC_PLL_STATIC_P_IS_USB_EXACT(SYSCLK,P)     (RCC_PLL_STATIC_P_IS_VALID(SYSCLK,P) && \
+                                                    ((RCC_PLL_STATIC_N_FACTOR(SYSCLK,P) % (RCC_PLL_USB_CLOCK_FREQUENCY / RCC_PLL_VCO_INPUT_MIN_FREQUENCY)) == 0UL))
+
+/* Get the P divider [2 - 4 - 6 - 8] for a constant system clock. */
+#define RCC_PLL_STATIC_P_DIVIDER(SYSCLK)            (RCC_PLL_STATIC_P_IS_USB_EXACT(SYSCLK,2UL) ? 2UL : RCC_PLL_STATIC_P_IS_USB_EXACT(SYSCLK,4UL) ? 4UL : \
+                                                    RCC_PLL_STATIC_P_IS_USB_EXACT(SYSCLK,6UL) ? 6UL : RCC_PLL_STATIC_P_IS_USB_EXACT(SYSCLK,8UL) ? 8UL : \
+                                                    RCC_PLL_STATIC_P_IS_VALID(SYSCLK,2UL) ? 2UL : RCC_PLL_STATIC_P_IS_VALID(SYSCLK,4UL) ? 4UL : \
+                                                    RCC_PLL_STATIC_P_IS_VALID(SYSCLK,6UL) ? 6UL : 8UL)
+
+/* Get the VCO output frequency for a constant system clock. */
+#define RCC_PLL_STATIC_VCO_FREQUENCY(SYSCLK)        (RCC_PLL_STATIC_N_FACTOR(SYSCLK,RCC_PLL_STATIC_P_DIVIDER(SYSCLK)) * RCC_PLL_VCO_INPUT_MIN_FREQUENCY)
+
+/* Get the generated system clock and its error in Hz from the required constant system clock. */
+#define RCC_PLL_STATIC_SYSTEM_CLOCK(SYSCLK)         (RCC_PLL_STATIC_VCO_FREQUENCY(SYSCLK) / RCC_PLL_STATIC_P_DIVIDER(SYSCLK))
+#define RCC_PLL_STATIC_FREQUENCY_ERROR(SYSCLK)      ((RCC_PLL_STATIC_SYSTEM_CLOCK(SYSCLK) > (uint32)(SYSCLK)) ? \
+                                                    (RCC_PLL_STATIC_SYSTEM_CLOCK(SYSCLK) - (uint32)(SYSCLK)) : ((uint32)(SYSCLK) - RCC_PLL_STATIC_SYSTEM_CLOCK(SYSCLK)))
+
+/* Check if a constant system clock can be generated from a constant input clock, and if the USB clock is exact. */
+#define RCC_PLL_STATIC_IS_VALID(FIN,SYSCLK)         ((((uint32)(FIN) % RCC_PLL_VCO_INPUT_MIN_FREQUENCY) == 0UL) && \
+                                                    (((uint32)(FIN) / RCC_PLL_VCO_INPUT_MIN_FREQUENCY) >= 2UL) && \
+                                                    (((uint32)(FIN) / RCC_PLL_VCO_INPUT_MIN_FREQUENCY) <= 63UL) && \
+                                                    ((uint32)(SYSCLK) <= RCC_SYSTEM_CLOCK_MAX_FREQUENCY) && \
+                                                    RCC_PLL_STATIC_P_IS_VALID(SYSCLK,RCC_PLL_STATIC_P_DIVIDER(SYSCLK)))
+#define RCC_PLL_STATIC_IS_USB_EXACT(SYSCLK)         RCC_PLL_STATIC_P_IS_USB_EXACT(SYSCLK,RCC_PLL_STATIC_P_DIVIDER(SYSCLK))
+
+/* Get an initializer of RCC_PLLConfigurationsType for a constant system clock, the Q divider is the smallest one
+ * that keeps the USB clock at or below 48 MHz. Check the result using RCC_PLL_STATIC_IS_VALID in a static assert. */
+#define RCC_PLL_STATIC_CONFIGURATIONS(SOURCE,FIN,SYSCLK) \
+    {(SOURCE), \
+     (uint16)RCC_PLL_STATIC_N_FACTOR(SYSCLK,RCC_PLL_STATIC_P_DIVIDER(SYSCLK)), \
+     (uint8)((uint32)(FIN) / RCC_PLL_VCO_INPUT_MIN_FREQUENCY), \
+     (uint8)((RCC_PLL_STATIC_P_DIVIDER(SYSCLK) / 2UL) - 1UL), \
+     (uint8)((RCC_PLL_STATIC_VCO_FREQUENCY(SYSCLK) + RCC_PLL_USB_CLOCK_FREQUENCY - 1UL) / RCC_PLL_USB_CLOCK_FREQUENCY)}
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
 
 /*=====================================================================================================================
  * [Function Name] : RCC_enableClockSource
- * [Description]   : Enable a clock source [HSI clock - HSE clock - PLL clock].
+ * [Description]   : Enable a clock source [HSI clock - HSE clock - PLL clock], wait until it is ready and measure its
+ *                   startup time.
  * [Arguments]     : <a_clockSource>      -> Indicates to the required clock source to be enabled.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Clock Source Error.
+ *                                                          - Function Timeout Error.
  ====================================================================================================================*/
 RCC_errorStatusType RCC_enableClockSource(RCC_clockSourceType a_clockSource);
 
@@ -117,12 +210,50 @@ RCC_errorStatusType RCC_enableClockSource(RCC_clockSourceType a_clockSource);
  ====================================================================================================================*/
 RCC_errorStatusType RCC_disableClockSource(RCC_clockSourceType a_clockSource);
 
+/*=====================================================================================================================
+ * [Function Name] : RCC_enableClockSourceAsync
+ * [Description]   : Enable a clock source [HSI clock - HSE clock - PLL clock] without waiting for it to be ready, the
+ *                   RCC ready interrupt calls the clock ready call-back function with the measured startup time.
+ *                   The RCC interrupt [NVIC_RCC_IRQ] must be enabled by the application.
+ * [Arguments]     : <a_clockSource>      -> Indicates to the required clock source to be enabled.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Clock Source Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_enableClockSourceAsync(RCC_clockSourceType a_clockSource);
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_setClockReadyCallBackFunction
+ * [Description]   : Set the address of the call-back function called when a clock source enabled asynchronously is
+ *                   ready, it takes the clock source and its startup time in microseconds.
+ * [Arguments]     : <a_ptr2callBackFunction>  -> Pointer to the call-back function.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_setClockReadyCallBackFunction(void (*a_ptr2callBackFunction)(RCC_clockSourceType, uint32));
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getClockSourceStartupTime
+ * [Description]   : Get the measured startup time of the last bring-up of a specific clock source.
+ * [Arguments]     : <a_clockSource>      -> Indicates to the required clock source.
+ *                   <a_ptr2startupTime>  -> Pointer to variable to store the startup time in microseconds.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Clock Source Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getClockSourceStartupTime(RCC_clockSourceType a_clockSource, uint32* a_ptr2startupTime);
+
 /*=====================================================================================================================
  * [Function Name] : RCC_selectSystemClock
- * [Description]   : Select the system clock source [HSI clock - HSE clock - PLL clock].
+ * [Description]   : Select the system clock source [HSI clock - HSE clock - PLL clock], wait until the hardware
+ *                   switches to it, then update the clock tree. The FLASH wait states are raised before the switch
+ *                   and reduced after it to the minimum legal number for the new clock.
  * [Arguments]     : <a_clockSource>  -> Indicates to the required clock source to provide the system with the clock.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Clock Source Error.
+ *                                                          - Prescaler Error [APB1 Clock Above 42 MHz].
+ *                                                          - FLASH Latency Error.
+ *                                                          - Function Timeout Error.
  ====================================================================================================================*/
 RCC_errorStatusType RCC_selectSystemClock(RCC_clockSourceType a_clockSource);
 
@@ -157,13 +288,86 @@ RCC_errorStatusType RCC_disablePeripheralClock(RCC_peripheralBusType a_periphera
 
 /*=====================================================================================================================
  * [Function Name] : RCC_configurePLL
- * [Description]   : Configure the PLL clock source according to some factors.
+ * [Description]   : Configure the PLL clock source according to some factors, the PLL must be disabled and must not
+ *                   be the system clock while its factors are changed.
  * [Arguments]     : <a_ptr2configurations>      -> Pointer to a structure that holds the PLL configurations.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Null Pointer Error.
  *                                                          - Clock Source Error.
  *                                                          - Wrong PLL Factor Error.
+ *                                                          - Busy Error.
  ====================================================================================================================*/
 RCC_errorStatusType RCC_configurePLL(RCC_PLLConfigurationsType* a_ptr2configurations);
 
+/*=====================================================================================================================
+ * [Function Name] : RCC_solvePLLConfigurations
+ * [Description]   : Search for the PLL factors that generate the nearest system clock to a required frequency within
+ *                   the VCO input and output limits, the result can be passed directly to RCC_configurePLL.
+ * [Arguments]     : <a_clockSource>         -> Indicates to the PLL input clock source [HSI clock - HSE clock].
+ *                   <a_systemClock>         -> Indicates to the required system clock frequency in Hz.
+ *                   <a_USBClockRequired>    -> Indicates if the USB clock must be exactly 48 MHz [TRUE - FALSE].
+ *                   <a_ptr2configurations>  -> Pointer to a structure to store the best PLL configurations.
+ *                   <a_ptr2frequencyError>  -> Pointer to variable to store the system clock error in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Clock Source Error.
+ *                                                          - No Solution Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_solvePLLConfigurations(RCC_clockSourceType a_clockSource, uint32 a_systemClock, uint8 a_USBClockRequired, RCC_PLLConfigurationsType* a_ptr2configurations, uint32* a_ptr2frequencyError);
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_setAHBPrescaler
+ * [Description]   : Set the AHB bus prescaler [divides the system clock], then update the clock tree and the FLASH
+ *                   wait states.
+ * [Arguments]     : <a_prescaler>      -> Indicates to the required AHB prescaler.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Prescaler Error [Also APB1 Clock Above 42 MHz].
+ *                                                          - FLASH Latency Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_setAHBPrescaler(RCC_AHBPrescalerType a_prescaler);
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_setAPBPrescaler
+ * [Description]   : Set the prescaler of a specific APB bus [divides the AHB clock], then update the clock tree.
+ * [Arguments]     : <a_peripheralBus>  -> Indicates to the required APB bus [APB1 - APB2].
+ *                   <a_prescaler>      -> Indicates to the required APB prescaler.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Peripheral Bus Error.
+ *                                                          - Prescaler Error [Also APB1 Clock Above 42 MHz].
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_setAPBPrescaler(RCC_peripheralBusType a_peripheralBus, RCC_APBPrescalerType a_prescaler);
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getClockTree
+ * [Description]   : Get the current frequencies of the system clock and the buses clocks.
+ * [Arguments]     : <a_ptr2clockTree>  -> Pointer to a structure to store the clock tree frequencies.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getClockTree(RCC_clockTreeType* a_ptr2clockTree);
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getBusClockFrequency
+ * [Description]   : Get the current clock frequency of a specific bus, used by the peripherals on this bus to
+ *                   calculate their dividers.
+ * [Arguments]     : <a_peripheralBus>  -> Indicates to the required bus.
+ *                   <a_ptr2frequency>  -> Pointer to variable to store the bus clock frequency in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Peripheral Bus Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getBusClockFrequency(RCC_peripheralBusType a_peripheralBus, uint32* a_ptr2frequency);
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getTimersClockFrequency
+ * [Description]   : Get the current clock frequency of the timers on a specific APB bus, which is twice the bus
+ *                   clock when the APB prescaler divides the AHB clock.
+ * [Arguments]     : <a_peripheralBus>  -> Indicates to the required APB bus [APB1 - APB2].
+ *                   <a_ptr2frequency>  -> Pointer to variable to store the timers clock frequency in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Peripheral Bus Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getTimersClockFrequency(RCC_peripheralBusType a_peripheralBus, uint32* a_ptr2frequency);
+
 #endif /* MCAL_RCC_INCLUDES_RCC_H_ */
@@ -16,6 +16,7 @@ Description  : Configuration file for the STM32F401xx RCC peripheral driver.
                                 < Definitions and Static Configurations >
 =====================================================================================================================*/
 
-
+/* Set the frequency of the external crystal/oscillator connected to the HSE clock source. */
+#define RCC_HSE_CLOCK_FREQUENCY              (25000000UL)
 
 #endif /* MCAL_RCC_INCLUDES_RCC_CFG_H_ */
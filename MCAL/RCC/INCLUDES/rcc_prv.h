@@ -19,6 +19,12 @@ Description  : Private file for the STM32F401xx RCC peripheral driver.
 /* The function timeout used in RCC_enableClockSource function. */
 #define RCC_FUNCTION_TIMEOUT_VALUE                              (1000000UL)
 
+/* The number of the system clock sources [HSI clock - HSE clock - PLL clock]. */
+#define RCC_NUMBER_OF_CLOCK_SOURCES                             (3U)
+
+/* The frequency of the High Speed Internal clock source. */
+#define RCC_HSI_CLOCK_FREQUENCY                                 (16000000UL)
+
 /* PLL Configurations: N Factor. */
 #define RCC_PLL_N_FACTOR_MIN_VALUE                              (2UL)
 #define RCC_PLL_N_FACTOR_MAX_VALUE                              (510UL)
@@ -102,8 +108,26 @@ typedef struct
 #define RCC_PLLCFGR_PLLSRC_BIT                    (22UL)
 #define RCC_PLLCFGR_PLLQ_FIELD                    (24UL)
 
+/* CIR register bits number [the bits of the HSE and the PLL clocks follow the HSI clock bits in order]. */
+#define RCC_CIR_HSIRDYF_BIT                       (2UL)
+#define RCC_CIR_HSIRDYIE_BIT                      (10UL)
+#define RCC_CIR_HSIRDYC_BIT                       (18UL)
+
 /* CFGR register fields and bits number. */
 #define RCC_CFGR_SW_FIELD                         (0UL)
 #define RCC_CFGR_SWS_FIELD                        (2UL)
+#define RCC_CFGR_HPRE_FIELD                       (4UL)
+#define RCC_CFGR_PPRE1_FIELD                      (10UL)
+#define RCC_CFGR_PPRE2_FIELD                      (13UL)
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the AHB division factor from the HPRE field value [0XXX: 1 - 1000: 2 - 1001: 4 - ... 1011: 16 - 1100: 64 ...]. */
+#define RCC_GET_AHB_DIVISION_FACTOR(HPRE)      (((HPRE) < 8UL) ? 1UL : (((HPRE) < 12UL) ? (2UL << ((HPRE) - 8UL)) : (4UL << ((HPRE) - 8UL))))
+
+/* Get the APB division factor from the PPRE field value [0XX: 1 - 100: 2 - 101: 4 - 110: 8 - 111: 16]. */
+#define RCC_GET_APB_DIVISION_FACTOR(PPRE)      (((PPRE) < 4UL) ? 1UL : (2UL << ((PPRE) - 4UL)))
 
 #endif /* MCAL_RCC_INCLUDES_RCC_PRV_H_ */
@@ -15,14 +15,184 @@ Description  : Source file for the STM32F401xx RCC peripheral driver.
 
 #include "../../../OTHERS/std_types.h"
 #include "../../../OTHERS/common_macros.h"
+#include "../../../OTHERS/bit_banding.h"
 #include "../INCLUDES/rcc_prv.h"
 #include "../INCLUDES/rcc_cfg.h"
 #include "../INCLUDES/rcc.h"
+#include "../../FLASH/INCLUDES/flash.h"
+#include "../../DWT/INCLUDES/dwt.h"
+
+/*=====================================================================================================================
+                                           < Global Variables >
+=====================================================================================================================*/
+
+/* The current clock tree frequencies, the reset values are taken from the HSI clock without any division. */
+static RCC_clockTreeType G_clockTree = {RCC_HSI_CLOCK_FREQUENCY,RCC_HSI_CLOCK_FREQUENCY,RCC_HSI_CLOCK_FREQUENCY,RCC_HSI_CLOCK_FREQUENCY};
+
+/* The cycle count at the start of every clock source bring-up, and the measured startup times in microseconds. */
+static uint32 G_startupStartCycles[RCC_NUMBER_OF_CLOCK_SOURCES] = {0};
+static uint32 G_startupTimes[RCC_NUMBER_OF_CLOCK_SOURCES] = {0};
+
+/* Pointer to the call-back function called when a clock source enabled asynchronously is ready. */
+static void (*G_ptr2clockReadyCallBackFunction)(RCC_clockSourceType, uint32) = NULL_PTR;
 
 /*=====================================================================================================================
                                           < Functions Definitions >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : RCC_getClockSourceFrequency
+ * [Description]   : Calculate the frequency of a specific clock source, the PLL clock is calculated from its current
+ *                   input clock and factors.
+ * [Arguments]     : <a_clockSource>  -> Indicates to the required clock source [HSI clock - HSE clock - PLL clock].
+ * [return]        : The function returns the clock source frequency in Hz.
+ ====================================================================================================================*/
+static uint32 RCC_getClockSourceFrequency(RCC_clockSourceType a_clockSource)
+{
+    uint32 LOC_frequency = RCC_HSI_CLOCK_FREQUENCY;
+
+    switch (a_clockSource)
+    {
+    case RCC_HSE_CLOCK:
+        LOC_frequency = RCC_HSE_CLOCK_FREQUENCY;
+        break;
+
+    case RCC_PLL_CLOCK:
+        {
+            uint32 LOC_inputClock = (BIT_IS_SET(RCC->PLLCFGR,RCC_PLLCFGR_PLLSRC_BIT) ? RCC_HSE_CLOCK_FREQUENCY : RCC_HSI_CLOCK_FREQUENCY);
+            uint32 LOC_M = ((RCC->PLLCFGR >> RCC_PLLCFGR_PLLM_FIELD) & 0X3FUL);
+            uint32 LOC_N = ((RCC->PLLCFGR >> RCC_PLLCFGR_PLLN_FIELD) & 0X1FFUL);
+            uint32 LOC_P = ((((RCC->PLLCFGR >> RCC_PLLCFGR_PLLP_FIELD) & 0X03UL) + 1UL) * 2UL);
+
+            /* PLL Clock = ((Input Clock / M) * N) / P, calculated in 64-bit to keep the precision of the division. */
+            if(LOC_M != 0) LOC_frequency = (uint32)(((uint64)LOC_inputClock * LOC_N) / (LOC_M * LOC_P));
+        }
+        break;
+
+    default:
+        /* HSI clock frequency. */
+        break;
+    }
+
+    return LOC_frequency;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_updateClockTree
+ * [Description]   : Calculate the clock tree frequencies from the clock source reported by the hardware, the PLL
+ *                   factors and the prescalers.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void RCC_updateClockTree(void)
+{
+    G_clockTree.systemClock = RCC_getClockSourceFrequency((RCC_clockSourceType)((RCC->CFGR >> RCC_CFGR_SWS_FIELD) & 0X03UL));
+    G_clockTree.AHBClock = G_clockTree.systemClock / RCC_GET_AHB_DIVISION_FACTOR((RCC->CFGR >> RCC_CFGR_HPRE_FIELD) & 0X0FUL);
+    G_clockTree.APB1Clock = G_clockTree.AHBClock / RCC_GET_APB_DIVISION_FACTOR((RCC->CFGR >> RCC_CFGR_PPRE1_FIELD) & 0X07UL);
+    G_clockTree.APB2Clock = G_clockTree.AHBClock / RCC_GET_APB_DIVISION_FACTOR((RCC->CFGR >> RCC_CFGR_PPRE2_FIELD) & 0X07UL);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_prepareFlashLatency
+ * [Description]   : Set the FLASH wait states for the higher of the current and the next AHB clocks before changing
+ *                   the AHB clock, so the code fetched from the FLASH memory is valid during and after the change.
+ * [Arguments]     : <a_nextAHBClock>  -> Indicates to the AHB clock frequency after the change in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - FLASH Latency Error.
+ ====================================================================================================================*/
+static RCC_errorStatusType RCC_prepareFlashLatency(uint32 a_nextAHBClock)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+    uint32 LOC_maxAHBClock = ((a_nextAHBClock > G_clockTree.AHBClock) ? a_nextAHBClock : G_clockTree.AHBClock);
+
+    if(FLASH_configureForFrequency(LOC_maxAHBClock) != FLASH_NO_ERRORS)
+    {
+        LOC_errorStatus = RCC_FLASH_LATENCY_ERROR;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_checkAPB1Clock
+ * [Description]   : Check if the APB1 clock generated from a specific AHB clock and APB1 prescaler is within its limit.
+ * [Arguments]     : <a_AHBClock>       -> Indicates to the AHB clock frequency in Hz.
+ *                   <a_APB1Prescaler>  -> Indicates to the APB1 prescaler [PPRE1 field value].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Prescaler Error.
+ ====================================================================================================================*/
+static RCC_errorStatusType RCC_checkAPB1Clock(uint32 a_AHBClock, uint32 a_APB1Prescaler)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if((a_AHBClock / RCC_GET_APB_DIVISION_FACTOR(a_APB1Prescaler)) > RCC_APB1_CLOCK_MAX_FREQUENCY)
+    {
+        LOC_errorStatus = RCC_PRESCALER_ERROR;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_reduceFlashLatency
+ * [Description]   : Reduce the FLASH wait states to the minimum legal number for the AHB clock in the clock tree, it is
+ *                   called only after the hardware has changed the clock, so the wait states never fall below the
+ *                   ones required by the running clock.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void RCC_reduceFlashLatency(void)
+{
+    FLASH_configureForFrequency(G_clockTree.AHBClock);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_recordStartupTime
+ * [Description]   : Calculate the startup time of a specific clock source from the cycles elapsed since its bring-up
+ *                   started, using the current system clock frequency.
+ * [Arguments]     : <a_clockSource>  -> Indicates to the required clock source.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void RCC_recordStartupTime(RCC_clockSourceType a_clockSource)
+{
+    uint32 LOC_elapsedCycles = (DWT_getCycleCount() - *(G_startupStartCycles + a_clockSource));
+    *(G_startupTimes + a_clockSource) = (uint32)(((uint64)LOC_elapsedCycles * 1000000ULL) / G_clockTree.systemClock);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_evaluatePLLCandidate
+ * [Description]   : Check if specific PLL factors are within the PLL limits, and store them as the best configurations
+ *                   if they generate a system clock nearer to the required frequency than the current best ones.
+ * [Arguments]     : <a_inputClock>          -> Indicates to the PLL input clock frequency in Hz.
+ *                   <a_systemClock>         -> Indicates to the required system clock frequency in Hz.
+ *                   <a_M>                   -> Indicates to the M division factor.
+ *                   <a_N>                   -> Indicates to the N multiplication factor.
+ *                   <a_P>                   -> Indicates to the P division factor [2 - 4 - 6 - 8].
+ *                   <a_Q>                   -> Indicates to the Q division factor.
+ *                   <a_ptr2configurations>  -> Pointer to the best PLL configurations.
+ *                   <a_ptr2frequencyError>  -> Pointer to the error of the best PLL configurations in Hz.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void RCC_evaluatePLLCandidate(uint32 a_inputClock, uint32 a_systemClock, uint32 a_M, uint32 a_N, uint32 a_P, uint32 a_Q, \
+                                     RCC_PLLConfigurationsType* a_ptr2configurations, uint32* a_ptr2frequencyError)
+{
+    uint64 LOC_VCOFrequency = (((uint64)a_inputClock * a_N) / a_M);
+    uint32 LOC_generatedClock = (uint32)(((uint64)a_inputClock * a_N) / (a_M * a_P));
+    uint32 LOC_error = ((LOC_generatedClock > a_systemClock) ? (LOC_generatedClock - a_systemClock) : (a_systemClock - LOC_generatedClock));
+
+    if((a_N >= RCC_PLL_N_FACTOR_MIN_VALUE) && (a_N <= RCC_PLL_N_FACTOR_MAX_VALUE) && (a_N != RCC_PLL_N_FACTOR_WRONG_CONFIGURATION) && \
+       (a_Q >= RCC_PLL_Q_FACTOR_MIN_VALUE) && (a_Q <= RCC_PLL_Q_FACTOR_MAX_VALUE) && \
+       (LOC_VCOFrequency >= RCC_PLL_VCO_OUTPUT_MIN_FREQUENCY) && (LOC_VCOFrequency <= RCC_PLL_VCO_OUTPUT_MAX_FREQUENCY) && \
+       (LOC_generatedClock <= RCC_SYSTEM_CLOCK_MAX_FREQUENCY) && (LOC_error < *a_ptr2frequencyError))
+    {
+        a_ptr2configurations->M_division_factor = (uint8)a_M;
+        a_ptr2configurations->N_multiplication_factor = (uint16)a_N;
+        a_ptr2configurations->P_division_factor = (uint8)((a_P / 2UL) - 1UL);
+        a_ptr2configurations->Q_division_factor = (uint8)a_Q;
+        *a_ptr2frequencyError = LOC_error;
+    }
+}
+
 /*=====================================================================================================================
  * [Function Name] : RCC_enableClockSource
  * [Description]   : Enable a clock source [HSI clock - HSE clock - PLL clock].
@@ -42,12 +212,16 @@ RCC_errorStatusType RCC_enableClockSource(RCC_clockSourceType a_clockSource)
 
     else
     {
+        /* Start measuring the startup time of the clock source. */
+        DWT_enableCycleCounter();
+        *(G_startupStartCycles + a_clockSource) = DWT_getCycleCount();
+
         switch (a_clockSource)
         {
         case RCC_HSI_CLOCK:
             SET_BIT(RCC->CR,RCC_CR_HSION_BIT);                 /* Enable the HSI clock source. */
             /* Wait until the HSI clock ready flag is set or the function's timeout has ended. */
-            while((BIT_IS_CLEAR(RCC->CR,RCC_CR_HSIRDY_BIT)) && (LOC_functionTimeout--));
+            while((BIT_IS_CLEAR(RCC->CR,RCC_CR_HSIRDY_BIT)) && (--LOC_functionTimeout));
             /* If the function's timeout has ended, return the Function Timeout error.         */
             if(LOC_functionTimeout == 0) LOC_errorStatus = RCC_FUNCTION_TIMEOUT_ERROR;
             break;
@@ -55,7 +229,7 @@ RCC_errorStatusType RCC_enableClockSource(RCC_clockSourceType a_clockSource)
         case RCC_HSE_CLOCK:
             SET_BIT(RCC->CR,RCC_CR_HSEON_BIT);                 /* Enable the HSE clock source. */
             /* Wait until the HSE clock ready flag is set or the function's timeout has ended. */
-            while((BIT_IS_CLEAR(RCC->CR,RCC_CR_HSERDY_BIT)) && (LOC_functionTimeout--));
+            while((BIT_IS_CLEAR(RCC->CR,RCC_CR_HSERDY_BIT)) && (--LOC_functionTimeout));
             /* If the function's timeout has ended, return the Function Timeout error.         */
             if(LOC_functionTimeout == 0) LOC_errorStatus = RCC_FUNCTION_TIMEOUT_ERROR;
             break;
@@ -63,7 +237,7 @@ RCC_errorStatusType RCC_enableClockSource(RCC_clockSourceType a_clockSource)
         case RCC_PLL_CLOCK:
             SET_BIT(RCC->CR,RCC_CR_PLLON_BIT);                 /* Enable the PLL clock source. */
             /* Wait until the PLL clock ready flag is set or the function's timeout has ended. */
-            while((BIT_IS_CLEAR(RCC->CR,RCC_CR_PLLRDY_BIT)) && (LOC_functionTimeout--));
+            while((BIT_IS_CLEAR(RCC->CR,RCC_CR_PLLRDY_BIT)) && (--LOC_functionTimeout));
             /* If the function's timeout has ended, return the Function Timeout error.         */
             if(LOC_functionTimeout == 0) LOC_errorStatus = RCC_FUNCTION_TIMEOUT_ERROR;
             break;
@@ -72,6 +246,58 @@ RCC_errorStatusType RCC_enableClockSource(RCC_clockSourceType a_clockSource)
             /* Do Nothing. */
             break;
         }
+
+        if(LOC_errorStatus == RCC_NO_ERRORS) RCC_recordStartupTime(a_clockSource);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_enableClockSourceAsync
+ * [Description]   : Enable a clock source [HSI clock - HSE clock - PLL clock] without waiting for it to be ready, the
+ *                   RCC ready interrupt calls the clock ready call-back function with the measured startup time.
+ *                   The RCC interrupt [NVIC_RCC_IRQ] must be enabled by the application.
+ * [Arguments]     : <a_clockSource>      -> Indicates to the required clock source to be enabled.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Clock Source Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_enableClockSourceAsync(RCC_clockSourceType a_clockSource)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+    uint8 LOC_enableBits[RCC_NUMBER_OF_CLOCK_SOURCES] = {RCC_CR_HSION_BIT,RCC_CR_HSEON_BIT,RCC_CR_PLLON_BIT};
+    uint8 LOC_readyBits[RCC_NUMBER_OF_CLOCK_SOURCES] = {RCC_CR_HSIRDY_BIT,RCC_CR_HSERDY_BIT,RCC_CR_PLLRDY_BIT};
+
+    if((a_clockSource != RCC_HSI_CLOCK) && (a_clockSource != RCC_HSE_CLOCK) && (a_clockSource != RCC_PLL_CLOCK))
+    {
+        LOC_errorStatus = RCC_CLOCK_SOURCE_ERROR;
+    }
+
+    else if(BIT_IS_SET(RCC->CIR,(RCC_CIR_HSIRDYIE_BIT + a_clockSource)))
+    {
+        LOC_errorStatus = RCC_BUSY_ERROR;
+    }
+
+    else
+    {
+        /* Start measuring the startup time of the clock source. */
+        DWT_enableCycleCounter();
+        *(G_startupStartCycles + a_clockSource) = DWT_getCycleCount();
+
+        if(BIT_IS_SET(RCC->CR,*(LOC_readyBits + a_clockSource)))
+        {
+            /* The clock source is already running, so no ready interrupt will be generated for it. */
+            *(G_startupTimes + a_clockSource) = 0;
+            if(G_ptr2clockReadyCallBackFunction != NULL_PTR) G_ptr2clockReadyCallBackFunction(a_clockSource,0);
+        }
+
+        else
+        {
+            SET_BIT(RCC->CIR,(RCC_CIR_HSIRDYC_BIT + a_clockSource));      /* Clear the old ready flag.         */
+            SET_BIT(RCC->CIR,(RCC_CIR_HSIRDYIE_BIT + a_clockSource));     /* Enable the ready interrupt.       */
+            SET_BIT(RCC->CR,*(LOC_enableBits + a_clockSource));           /* Enable the clock source.          */
+        }
     }
 
     return LOC_errorStatus;
@@ -120,23 +346,52 @@ RCC_errorStatusType RCC_disableClockSource(RCC_clockSourceType a_clockSource)
 
 /*=====================================================================================================================
  * [Function Name] : RCC_selectSystemClock
- * [Description]   : Select the system clock source [HSI clock - HSE clock - PLL clock].
+ * [Description]   : Select the system clock source [HSI clock - HSE clock - PLL clock], wait until the hardware
+ *                   switches to it, then update the clock tree. The FLASH wait states are raised before the switch
+ *                   and reduced after it to the minimum legal number for the new clock.
  * [Arguments]     : <a_clockSource>  -> Indicates to the required clock source to provide the system with the clock.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Clock Source Error.
+ *                                                          - Prescaler Error [APB1 Clock Above 42 MHz].
+ *                                                          - FLASH Latency Error.
+ *                                                          - Function Timeout Error.
  ====================================================================================================================*/
 RCC_errorStatusType RCC_selectSystemClock(RCC_clockSourceType a_clockSource)
 {
     RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+    uint32 LOC_functionTimeout = RCC_FUNCTION_TIMEOUT_VALUE;
 
     if((a_clockSource != RCC_HSI_CLOCK) && (a_clockSource != RCC_HSE_CLOCK) && (a_clockSource != RCC_PLL_CLOCK))
     {
         LOC_errorStatus = RCC_CLOCK_SOURCE_ERROR;
     }
 
+    else if(RCC_checkAPB1Clock((RCC_getClockSourceFrequency(a_clockSource) / \
+                                RCC_GET_AHB_DIVISION_FACTOR((RCC->CFGR >> RCC_CFGR_HPRE_FIELD) & 0X0FUL)), \
+                               ((RCC->CFGR >> RCC_CFGR_PPRE1_FIELD) & 0X07UL)) != RCC_NO_ERRORS)
+    {
+        LOC_errorStatus = RCC_PRESCALER_ERROR;
+    }
+
+    else if(RCC_prepareFlashLatency(RCC_getClockSourceFrequency(a_clockSource) / \
+                                    RCC_GET_AHB_DIVISION_FACTOR((RCC->CFGR >> RCC_CFGR_HPRE_FIELD) & 0X0FUL)) != RCC_NO_ERRORS)
+    {
+        LOC_errorStatus = RCC_FLASH_LATENCY_ERROR;
+    }
+
     else
     {
-        RCC->CFGR = ((RCC->CFGR & 0XFCUL) | (a_clockSource));              /* Select the required clock source. */
+        /* Select the required clock source, and keep the prescalers and the other fields of the register. */
+        RCC->CFGR = ((RCC->CFGR & (~(0X03UL << RCC_CFGR_SW_FIELD))) | ((uint32)a_clockSource << RCC_CFGR_SW_FIELD));
+        /* Wait until the hardware reports the required clock source as the system clock or the timeout has ended. */
+        while((((RCC->CFGR >> RCC_CFGR_SWS_FIELD) & 0X03UL) != a_clockSource) && (--LOC_functionTimeout));
+
+        RCC_updateClockTree();
+
+        /* If the function's timeout has ended, return the Function Timeout error and keep the raised wait states, as
+         * the switch may still be done later. Otherwise, reduce the wait states for the running clock. */
+        if(LOC_functionTimeout == 0) LOC_errorStatus = RCC_FUNCTION_TIMEOUT_ERROR;
+        else RCC_reduceFlashLatency();
     }
 
     return LOC_errorStatus;
@@ -188,19 +443,19 @@ RCC_errorStatusType RCC_enablePeripheralClock(RCC_peripheralBusType a_peripheral
         switch (a_peripheralBus)
         {
         case RCC_AHB1_BUS:
-            SET_BIT(RCC->AHB1ENR,a_peripheral);     /* Enable the clock for a specific peripheral on AHB1 bus. */
+            BIT_BAND_SET_BIT(RCC->AHB1ENR,a_peripheral);   /* Enable the clock for a specific peripheral on AHB1 bus. */
             break;
         
         case RCC_AHB2_BUS:
-            SET_BIT(RCC->AHB2ENR,a_peripheral);     /* Enable the clock for a specific peripheral on AHB2 bus. */
+            BIT_BAND_SET_BIT(RCC->AHB2ENR,a_peripheral);   /* Enable the clock for a specific peripheral on AHB2 bus. */
             break;
         
         case RCC_APB1_BUS:
-            SET_BIT(RCC->APB1ENR,a_peripheral);     /* Enable the clock for a specific peripheral on APB1 bus. */
+            BIT_BAND_SET_BIT(RCC->APB1ENR,a_peripheral);   /* Enable the clock for a specific peripheral on APB1 bus. */
             break;
         
         case RCC_APB2_BUS:
-            SET_BIT(RCC->APB2ENR,a_peripheral);     /* Enable the clock for a specific peripheral on APB2 bus. */
+            BIT_BAND_SET_BIT(RCC->APB2ENR,a_peripheral);   /* Enable the clock for a specific peripheral on APB2 bus. */
             break;
         
         default:
@@ -234,19 +489,19 @@ RCC_errorStatusType RCC_disablePeripheralClock(RCC_peripheralBusType a_periphera
         switch (a_peripheralBus)
         {
         case RCC_AHB1_BUS:
-            CLEAR_BIT(RCC->AHB1ENR,a_peripheral);  /* Disable the clock for a specific peripheral on AHB1 bus. */
+            BIT_BAND_CLEAR_BIT(RCC->AHB1ENR,a_peripheral); /* Disable the clock for a specific peripheral on AHB1 bus. */
             break;
         
         case RCC_AHB2_BUS:
-            CLEAR_BIT(RCC->AHB2ENR,a_peripheral);  /* Disable the clock for a specific peripheral on AHB2 bus. */
+            BIT_BAND_CLEAR_BIT(RCC->AHB2ENR,a_peripheral); /* Disable the clock for a specific peripheral on AHB2 bus. */
             break;
         
         case RCC_APB1_BUS:
-            CLEAR_BIT(RCC->APB1ENR,a_peripheral);  /* Disable the clock for a specific peripheral on APB1 bus. */
+            BIT_BAND_CLEAR_BIT(RCC->APB1ENR,a_peripheral); /* Disable the clock for a specific peripheral on APB1 bus. */
             break;
         
         case RCC_APB2_BUS:
-            CLEAR_BIT(RCC->APB2ENR,a_peripheral);  /* Disable the clock for a specific peripheral on APB2 bus. */
+            BIT_BAND_CLEAR_BIT(RCC->APB2ENR,a_peripheral); /* Disable the clock for a specific peripheral on APB2 bus. */
             break;
         
         default:
@@ -260,12 +515,14 @@ RCC_errorStatusType RCC_disablePeripheralClock(RCC_peripheralBusType a_periphera
 
 /*=====================================================================================================================
  * [Function Name] : RCC_configurePLL
- * [Description]   : Configure the PLL clock source according to some factors.
+ * [Description]   : Configure the PLL clock source according to some factors, the PLL must be disabled and must not
+ *                   be the system clock while its factors are changed.
  * [Arguments]     : <a_ptr2configurations>      -> Pointer to a structure that holds the PLL configurations.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Null Pointer Error.
  *                                                          - Clock Source Error.
  *                                                          - Wrong PLL Factor Error.
+ *                                                          - Busy Error.
  ====================================================================================================================*/
 RCC_errorStatusType RCC_configurePLL(RCC_PLLConfigurationsType* a_ptr2configurations)
 {
@@ -306,6 +563,12 @@ RCC_errorStatusType RCC_configurePLL(RCC_PLLConfigurationsType* a_ptr2configurat
         LOC_errorStatus = RCC_PLL_WRONG_FACTOR_ERROR;
     }
 
+    /* The factors of a running PLL can not be changed, the system clock would change without the FLASH wait states. */
+    else if(BIT_IS_SET(RCC->CR,RCC_CR_PLLON_BIT) || (((RCC->CFGR >> RCC_CFGR_SWS_FIELD) & 0X03UL) == RCC_PLL_CLOCK))
+    {
+        LOC_errorStatus = RCC_BUSY_ERROR;
+    }
+
     else
     {
         /* Set the PLL factors to configure its output clock. */
@@ -318,3 +581,366 @@ RCC_errorStatusType RCC_configurePLL(RCC_PLLConfigurationsType* a_ptr2configurat
 
     return LOC_errorStatus;
 }
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_setAHBPrescaler
+ * [Description]   : Set the AHB bus prescaler [divides the system clock], then update the clock tree and the FLASH
+ *                   wait states.
+ * [Arguments]     : <a_prescaler>      -> Indicates to the required AHB prescaler.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Prescaler Error [Also APB1 Clock Above 42 MHz].
+ *                                                          - FLASH Latency Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_setAHBPrescaler(RCC_AHBPrescalerType a_prescaler)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if((a_prescaler != RCC_AHB_NOT_DIVIDED) && ((a_prescaler < RCC_AHB_DIVIDED_BY_2) || (a_prescaler > RCC_AHB_DIVIDED_BY_512)))
+    {
+        LOC_errorStatus = RCC_PRESCALER_ERROR;
+    }
+
+    else if(RCC_checkAPB1Clock((G_clockTree.systemClock / RCC_GET_AHB_DIVISION_FACTOR((uint32)a_prescaler)), \
+                               ((RCC->CFGR >> RCC_CFGR_PPRE1_FIELD) & 0X07UL)) != RCC_NO_ERRORS)
+    {
+        LOC_errorStatus = RCC_PRESCALER_ERROR;
+    }
+
+    else if(RCC_prepareFlashLatency(G_clockTree.systemClock / RCC_GET_AHB_DIVISION_FACTOR((uint32)a_prescaler)) != RCC_NO_ERRORS)
+    {
+        LOC_errorStatus = RCC_FLASH_LATENCY_ERROR;
+    }
+
+    else
+    {
+        /* Set the required prescaler in the HPRE field. */
+        RCC->CFGR = ((RCC->CFGR & (~(0X0FUL << RCC_CFGR_HPRE_FIELD))) | ((uint32)a_prescaler << RCC_CFGR_HPRE_FIELD));
+        RCC_updateClockTree();
+        RCC_reduceFlashLatency();
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_setAPBPrescaler
+ * [Description]   : Set the prescaler of a specific APB bus [divides the AHB clock], then update the clock tree.
+ * [Arguments]     : <a_peripheralBus>  -> Indicates to the required APB bus [APB1 - APB2].
+ *                   <a_prescaler>      -> Indicates to the required APB prescaler.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Peripheral Bus Error.
+ *                                                          - Prescaler Error [Also APB1 Clock Above 42 MHz].
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_setAPBPrescaler(RCC_peripheralBusType a_peripheralBus, RCC_APBPrescalerType a_prescaler)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if((a_peripheralBus != RCC_APB1_BUS) && (a_peripheralBus != RCC_APB2_BUS))
+    {
+        LOC_errorStatus = RCC_PERIPHERAL_BUS_ERROR;
+    }
+
+    else if((a_prescaler != RCC_APB_NOT_DIVIDED) && ((a_prescaler < RCC_APB_DIVIDED_BY_2) || (a_prescaler > RCC_APB_DIVIDED_BY_16)))
+    {
+        LOC_errorStatus = RCC_PRESCALER_ERROR;
+    }
+
+    else if((a_peripheralBus == RCC_APB1_BUS) && (RCC_checkAPB1Clock(G_clockTree.AHBClock,(uint32)a_prescaler) != RCC_NO_ERRORS))
+    {
+        LOC_errorStatus = RCC_PRESCALER_ERROR;
+    }
+
+    else
+    {
+        /* Set the required prescaler in the PPRE1 or the PPRE2 field. */
+        uint32 LOC_field = ((a_peripheralBus == RCC_APB1_BUS) ? RCC_CFGR_PPRE1_FIELD : RCC_CFGR_PPRE2_FIELD);
+        RCC->CFGR = ((RCC->CFGR & (~(0X07UL << LOC_field))) | ((uint32)a_prescaler << LOC_field));
+        RCC_updateClockTree();
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getClockTree
+ * [Description]   : Get the current frequencies of the system clock and the buses clocks.
+ * [Arguments]     : <a_ptr2clockTree>  -> Pointer to a structure to store the clock tree frequencies.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getClockTree(RCC_clockTreeType* a_ptr2clockTree)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if(a_ptr2clockTree == NULL_PTR)
+    {
+        LOC_errorStatus = RCC_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        *a_ptr2clockTree = G_clockTree;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getBusClockFrequency
+ * [Description]   : Get the current clock frequency of a specific bus, used by the peripherals on this bus to
+ *                   calculate their dividers.
+ * [Arguments]     : <a_peripheralBus>  -> Indicates to the required bus.
+ *                   <a_ptr2frequency>  -> Pointer to variable to store the bus clock frequency in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Peripheral Bus Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getBusClockFrequency(RCC_peripheralBusType a_peripheralBus, uint32* a_ptr2frequency)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if(a_ptr2frequency == NULL_PTR)
+    {
+        LOC_errorStatus = RCC_NULL_PTR_ERROR;
+    }
+
+    else if((a_peripheralBus != RCC_AHB1_BUS) && (a_peripheralBus != RCC_AHB2_BUS) && (a_peripheralBus != RCC_APB1_BUS) && (a_peripheralBus != RCC_APB2_BUS))
+    {
+        LOC_errorStatus = RCC_PERIPHERAL_BUS_ERROR;
+    }
+
+    else
+    {
+        switch (a_peripheralBus)
+        {
+        case RCC_APB1_BUS:
+            *a_ptr2frequency = G_clockTree.APB1Clock;
+            break;
+
+        case RCC_APB2_BUS:
+            *a_ptr2frequency = G_clockTree.APB2Clock;
+            break;
+
+        default:
+            /* AHB1 and AHB2 buses are clocked by HCLK. */
+            *a_ptr2frequency = G_clockTree.AHBClock;
+            break;
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getTimersClockFrequency
+ * [Description]   : Get the current clock frequency of the timers on a specific APB bus, which is twice the bus
+ *                   clock when the APB prescaler divides the AHB clock.
+ * [Arguments]     : <a_peripheralBus>  -> Indicates to the required APB bus [APB1 - APB2].
+ *                   <a_ptr2frequency>  -> Pointer to variable to store the timers clock frequency in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Peripheral Bus Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getTimersClockFrequency(RCC_peripheralBusType a_peripheralBus, uint32* a_ptr2frequency)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if(a_ptr2frequency == NULL_PTR)
+    {
+        LOC_errorStatus = RCC_NULL_PTR_ERROR;
+    }
+
+    else if((a_peripheralBus != RCC_APB1_BUS) && (a_peripheralBus != RCC_APB2_BUS))
+    {
+        LOC_errorStatus = RCC_PERIPHERAL_BUS_ERROR;
+    }
+
+    else
+    {
+        uint32 LOC_busClock = ((a_peripheralBus == RCC_APB1_BUS) ? G_clockTree.APB1Clock : G_clockTree.APB2Clock);
+        /* The timers clock equals the bus clock if the APB bus is not divided, otherwise it is doubled. */
+        *a_ptr2frequency = ((LOC_busClock == G_clockTree.AHBClock) ? LOC_busClock : (LOC_busClock * 2UL));
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_solvePLLConfigurations
+ * [Description]   : Search for the PLL factors that generate the nearest system clock to a required frequency within
+ *                   the VCO input and output limits, the result can be passed directly to RCC_configurePLL.
+ * [Arguments]     : <a_clockSource>         -> Indicates to the PLL input clock source [HSI clock - HSE clock].
+ *                   <a_systemClock>         -> Indicates to the required system clock frequency in Hz.
+ *                   <a_USBClockRequired>    -> Indicates if the USB clock must be exactly 48 MHz [TRUE - FALSE].
+ *                   <a_ptr2configurations>  -> Pointer to a structure to store the best PLL configurations.
+ *                   <a_ptr2frequencyError>  -> Pointer to variable to store the system clock error in Hz.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Clock Source Error.
+ *                                                          - No Solution Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_solvePLLConfigurations(RCC_clockSourceType a_clockSource, uint32 a_systemClock, uint8 a_USBClockRequired, RCC_PLLConfigurationsType* a_ptr2configurations, uint32* a_ptr2frequencyError)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if((a_ptr2configurations == NULL_PTR) || (a_ptr2frequencyError == NULL_PTR))
+    {
+        LOC_errorStatus = RCC_NULL_PTR_ERROR;
+    }
+
+    else if((a_clockSource != RCC_HSI_CLOCK) && (a_clockSource != RCC_HSE_CLOCK))
+    {
+        LOC_errorStatus = RCC_CLOCK_SOURCE_ERROR;
+    }
+
+    else if((a_systemClock == 0) || (a_systemClock > RCC_SYSTEM_CLOCK_MAX_FREQUENCY))
+    {
+        LOC_errorStatus = RCC_PLL_NO_SOLUTION_ERROR;
+    }
+
+    else
+    {
+        uint32 LOC_inputClock = ((a_clockSource == RCC_HSE_CLOCK) ? RCC_HSE_CLOCK_FREQUENCY : RCC_HSI_CLOCK_FREQUENCY);
+        uint32 LOC_M = 0, LOC_N = 0, LOC_P = 0, LOC_Q = 0;
+
+        a_ptr2configurations->clock_source = a_clockSource;
+        *a_ptr2frequencyError = 0XFFFFFFFFUL;
+
+        /* The smaller M factors are tried first, so the highest VCO input frequency [lowest PLL jitter] wins the ties. */
+        for(LOC_M = RCC_PLL_M_FACTOR_MIN_VALUE; (LOC_M <= RCC_PLL_M_FACTOR_MAX_VALUE) && (*a_ptr2frequencyError != 0); LOC_M++)
+        {
+            /* Skip the M factors that generate a VCO input frequency out of its range. */
+            if((LOC_inputClock < (LOC_M * RCC_PLL_VCO_INPUT_MIN_FREQUENCY)) || (LOC_inputClock > (LOC_M * RCC_PLL_VCO_INPUT_MAX_FREQUENCY))) continue;
+
+            if(a_USBClockRequired == TRUE)
+            {
+                /* The VCO output must be exactly [48 MHz * Q], so only the N factors generating it are tried. */
+                for(LOC_Q = RCC_PLL_Q_FACTOR_MIN_VALUE; LOC_Q <= RCC_PLL_Q_FACTOR_MAX_VALUE; LOC_Q++)
+                {
+                    uint64 LOC_scaledVCOFrequency = ((uint64)RCC_PLL_USB_CLOCK_FREQUENCY * LOC_Q * LOC_M);
+                    if((LOC_scaledVCOFrequency % LOC_inputClock) != 0) continue;
+
+                    LOC_N = (uint32)(LOC_scaledVCOFrequency / LOC_inputClock);
+                    for(LOC_P = 2; LOC_P <= 8; LOC_P += 2)
+                    {
+                        RCC_evaluatePLLCandidate(LOC_inputClock,a_systemClock,LOC_M,LOC_N,LOC_P,LOC_Q,a_ptr2configurations,a_ptr2frequencyError);
+                    }
+                }
+            }
+
+            else
+            {
+                for(LOC_P = 2; LOC_P <= 8; LOC_P += 2)
+                {
+                    /* N = the nearest integer of [(System Clock * P * M) / Input Clock]. */
+                    LOC_N = (uint32)((((uint64)a_systemClock * LOC_P * LOC_M) + (LOC_inputClock / 2UL)) / LOC_inputClock);
+                    /* Limit N to the VCO output range, so the nearest possible clock is found for out of range clocks. */
+                    if(LOC_N < (uint32)((((uint64)RCC_PLL_VCO_OUTPUT_MIN_FREQUENCY * LOC_M) + LOC_inputClock - 1UL) / LOC_inputClock))
+                    {
+                        LOC_N = (uint32)((((uint64)RCC_PLL_VCO_OUTPUT_MIN_FREQUENCY * LOC_M) + LOC_inputClock - 1UL) / LOC_inputClock);
+                    }
+                    else if(LOC_N > (uint32)(((uint64)RCC_PLL_VCO_OUTPUT_MAX_FREQUENCY * LOC_M) / LOC_inputClock))
+                    {
+                        LOC_N = (uint32)(((uint64)RCC_PLL_VCO_OUTPUT_MAX_FREQUENCY * LOC_M) / LOC_inputClock);
+                    }
+                    /* Q = the smallest divider that keeps the USB clock at or below 48 MHz. */
+                    LOC_Q = (uint32)(((((uint64)LOC_inputClock * LOC_N) / LOC_M) + RCC_PLL_USB_CLOCK_FREQUENCY - 1UL) / RCC_PLL_USB_CLOCK_FREQUENCY);
+                    if(LOC_Q < RCC_PLL_Q_FACTOR_MIN_VALUE) LOC_Q = RCC_PLL_Q_FACTOR_MIN_VALUE;
+                    RCC_evaluatePLLCandidate(LOC_inputClock,a_systemClock,LOC_M,LOC_N,LOC_P,LOC_Q,a_ptr2configurations,a_ptr2frequencyError);
+                }
+            }
+        }
+
+        /* If no factors are within the PLL limits, return the No Solution error. */
+        if(*a_ptr2frequencyError == 0XFFFFFFFFUL) LOC_errorStatus = RCC_PLL_NO_SOLUTION_ERROR;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_setClockReadyCallBackFunction
+ * [Description]   : Set the address of the call-back function called when a clock source enabled asynchronously is
+ *                   ready, it takes the clock source and its startup time in microseconds.
+ * [Arguments]     : <a_ptr2callBackFunction>  -> Pointer to the call-back function.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_setClockReadyCallBackFunction(void (*a_ptr2callBackFunction)(RCC_clockSourceType, uint32))
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if(a_ptr2callBackFunction == NULL_PTR)
+    {
+        LOC_errorStatus = RCC_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        G_ptr2clockReadyCallBackFunction = a_ptr2callBackFunction;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_getClockSourceStartupTime
+ * [Description]   : Get the measured startup time of the last bring-up of a specific clock source.
+ * [Arguments]     : <a_clockSource>      -> Indicates to the required clock source.
+ *                   <a_ptr2startupTime>  -> Pointer to variable to store the startup time in microseconds.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - Clock Source Error.
+ ====================================================================================================================*/
+RCC_errorStatusType RCC_getClockSourceStartupTime(RCC_clockSourceType a_clockSource, uint32* a_ptr2startupTime)
+{
+    RCC_errorStatusType LOC_errorStatus = RCC_NO_ERRORS;
+
+    if(a_ptr2startupTime == NULL_PTR)
+    {
+        LOC_errorStatus = RCC_NULL_PTR_ERROR;
+    }
+
+    else if((a_clockSource != RCC_HSI_CLOCK) && (a_clockSource != RCC_HSE_CLOCK) && (a_clockSource != RCC_PLL_CLOCK))
+    {
+        LOC_errorStatus = RCC_CLOCK_SOURCE_ERROR;
+    }
+
+    else
+    {
+        *a_ptr2startupTime = *(G_startupTimes + a_clockSource);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : RCC_IRQHandler
+ * [Description]   : The interrupt service routine of the RCC, it completes the bring-up of every clock source that
+ *                   became ready and calls the clock ready call-back function for it.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+void RCC_IRQHandler(void)
+{
+    RCC_clockSourceType LOC_clockSource = RCC_HSI_CLOCK;
+
+    DWT_ISR_ENTER();
+
+    for(LOC_clockSource = RCC_HSI_CLOCK; LOC_clockSource <= RCC_PLL_CLOCK; LOC_clockSource++)
+    {
+        if(BIT_IS_SET(RCC->CIR,(RCC_CIR_HSIRDYIE_BIT + LOC_clockSource)) && BIT_IS_SET(RCC->CIR,(RCC_CIR_HSIRDYF_BIT + LOC_clockSource)))
+        {
+            RCC_recordStartupTime(LOC_clockSource);
+            CLEAR_BIT(RCC->CIR,(RCC_CIR_HSIRDYIE_BIT + LOC_clockSource));   /* Disable the ready interrupt. */
+            SET_BIT(RCC->CIR,(RCC_CIR_HSIRDYC_BIT + LOC_clockSource));      /* Clear the ready flag.        */
+
+            if(G_ptr2clockReadyCallBackFunction != NULL_PTR)
+            {
+                G_ptr2clockReadyCallBackFunction(LOC_clockSource,*(G_startupTimes + LOC_clockSource));
+            }
+        }
+    }
+
+    DWT_ISR_EXIT();
+}
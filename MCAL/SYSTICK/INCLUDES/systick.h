@@ -22,6 +22,10 @@ typedef enum
     SYSTICK_BUSY_ERROR,         /* SysTick is busy.                              */
     SYSTICK_NULL_PTR_ERROR,     /* Null Pointer Error.                           */
     SYSTICK_OVERFLOW_ERROR,     /* The time interval exceedes the SysTick limit. */
+    SYSTICK_TIMER_ID_ERROR,     /* Wrong or not created software timer ID.       */
+    SYSTICK_NO_FREE_TIMER_ERROR,/* All the software timers are created.          */
+    SYSTICK_TIME_INTERVAL_ERROR,/* Wrong time interval value.                    */
+    SYSTICK_MODE_ERROR,         /* SysTick is not running in the required mode.  */
 }SYSTICK_errorStatusType;
 
 typedef enum
@@ -30,6 +34,12 @@ typedef enum
     SYSTICK_CPU_CLOCK,          /* SysTick clock source is CPU clock.              */
 }SYSTICK_clockSourceType;
 
+typedef enum
+{
+    SYSTICK_ONE_SHOT_TIMER,     /* The software timer expires once then stops.         */
+    SYSTICK_PERIODIC_TIMER,     /* The software timer reloads itself after each expiry. */
+}SYSTICK_softwareTimerModeType;
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
@@ -44,13 +54,37 @@ void SYSTICK_init(SYSTICK_clockSourceType a_clockSource);
 
 /*=====================================================================================================================
  * [Function Name] : SYSTICK_setBusyWait
- * [Description]   : Set a blocking delay with a specific time interval.
+ * [Description]   : Set a blocking delay with a specific time interval. While the timebase is running, the delay is
+ *                   counted on the running counter if the SysTick interrupt can not run [handler mode - PRIMASK -
+ *                   BASEPRI].
  * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Busy Error.
- *                                                          - Overflow Error.
+ *                                                          - Time Interval Error.
  ====================================================================================================================*/
-SYSTICK_errorStatusType SYSTICK_setBusyWait(uint16 a_timeInterval);
+SYSTICK_errorStatusType SYSTICK_setBusyWait(uint32 a_timeInterval);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setBusyWaitMicros
+ * [Description]   : Set a blocking delay with a specific time interval in microseconds. While the timebase is running,
+ *                   the delay is counted on the running counter if the SysTick interrupt can not run [handler mode -
+ *                   PRIMASK - BASEPRI].
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in microseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setBusyWaitMicros(uint32 a_timeInterval);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setBusyWaitNanos
+ * [Description]   : Set a short blocking delay in nanoseconds on the DWT cycle counter, so it does not take SysTick.
+ *                   The cycles of the call itself are measured on the first call and subtracted from every delay,
+ *                   and the resolution is one CPU cycle.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in nanoseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setBusyWaitNanos(uint32 a_timeInterval);
 
 /*=====================================================================================================================
  * [Function Name] : SYSTICK_setSingleInterval
@@ -58,9 +92,19 @@ SYSTICK_errorStatusType SYSTICK_setBusyWait(uint16 a_timeInterval);
  * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Busy Error.
- *                                                          - Overflow Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setSingleInterval(uint32 a_timeInterval);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setSingleIntervalMicros
+ * [Description]   : Set a single non-blocking delay with a specific time interval in microseconds.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in microseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
  ====================================================================================================================*/
-SYSTICK_errorStatusType SYSTICK_setSingleInterval(uint16 a_timeInterval);
+SYSTICK_errorStatusType SYSTICK_setSingleIntervalMicros(uint32 a_timeInterval);
 
 /*=====================================================================================================================
  * [Function Name] : SYSTICK_setPeriodicInterval
@@ -68,9 +112,101 @@ SYSTICK_errorStatusType SYSTICK_setSingleInterval(uint16 a_timeInterval);
  * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setPeriodicInterval(uint32 a_timeInterval);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setPeriodicIntervalMicros
+ * [Description]   : Set a periodic non-blocking delay with a specific time interval in microseconds.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in microseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setPeriodicIntervalMicros(uint32 a_timeInterval);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_startTimebase
+ * [Description]   : Start SysTick as a free-running 64-bit timebase with a 1 millisecond tick, the call-back function
+ *                   [if set] is called every tick. The timebase must be restarted after changing the AHB clock.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
  *                                                          - Overflow Error.
  ====================================================================================================================*/
-SYSTICK_errorStatusType SYSTICK_setPeriodicInterval(uint16 a_timeInterval);
+SYSTICK_errorStatusType SYSTICK_startTimebase(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_enterTicklessIdle
+ * [Description]   : Sleep until the next software timer deadline or any other interrupt without the 1 millisecond
+ *                   ticks, by reloading the timebase counter with the whole idle period, then correct the timebase
+ *                   and the software timers with the ticks elapsed in the sleep. It is called from the idle loop.
+ *                   While a call-back function is set, it sleeps with the normal ticks to call it every tick.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Mode Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_enterTicklessIdle(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_getMillis
+ * [Description]   : Get the number of milliseconds elapsed since the timebase has started.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the elapsed time in milliseconds.
+ ====================================================================================================================*/
+uint64 SYSTICK_getMillis(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_getMicros
+ * [Description]   : Get the number of microseconds elapsed since the timebase has started, calculated from the ticks
+ *                   count and the current value of the counter.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the elapsed time in microseconds.
+ ====================================================================================================================*/
+uint64 SYSTICK_getMicros(void);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_createSoftwareTimer
+ * [Description]   : Allocate a software timer from the static pool, the software timers are counted by the timebase
+ *                   ticks [SYSTICK_startTimebase] and their call-back functions are called from the SysTick interrupt.
+ * [Arguments]     : <a_ptr2callBackFunction>  -> Pointer to the call-back function of the timer.
+ *                   <a_ptr2timerID>           -> Pointer to variable to store the ID of the created timer.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - No Free Timer Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_createSoftwareTimer(void (*a_ptr2callBackFunction)(void), uint16* a_ptr2timerID);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_startSoftwareTimer
+ * [Description]   : Start [or restart] a software timer to expire after a specific time interval.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ *                   <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
+ *                   <a_timerMode>         -> Indicates to the required timer mode [One-Shot - Periodic].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Timer ID Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_startSoftwareTimer(uint16 a_timerID, uint32 a_timeInterval, SYSTICK_softwareTimerModeType a_timerMode);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_stopSoftwareTimer
+ * [Description]   : Stop a running software timer, the timer keeps its ID and can be started again.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Timer ID Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_stopSoftwareTimer(uint16 a_timerID);
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_deleteSoftwareTimer
+ * [Description]   : Stop a software timer and return it to the static pool.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Timer ID Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_deleteSoftwareTimer(uint16 a_timerID);
 
 /*=====================================================================================================================
  * [Function Name] : SYSTICK_setCallBackFunction
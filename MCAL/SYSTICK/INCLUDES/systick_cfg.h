@@ -16,7 +16,7 @@ Description  : Configuration file for the ARM Cortex-M4 SysTick peripheral drive
                                 < Definitions and Static Configurations >
 =====================================================================================================================*/
 
-/* Set the CPU clock frequency [AHB clock]. */
-#define CPU_CLOCK                    (16000000UL)
+/* Set the number of the software timers in the static pool [1 ~ 65534]. */
+#define SYSTICK_NUMBER_OF_SOFTWARE_TIMERS    (16U)
 
 #endif /* MCAL_SYSTICK_INCLUDES_SYSTICK_CFG_H_ */
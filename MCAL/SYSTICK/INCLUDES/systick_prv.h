@@ -16,8 +16,22 @@ Description  : Private file for the ARM Cortex-M4 SysTick peripheral driver.
                                 < Definitions and Static Configurations >
 =====================================================================================================================*/
 
-#define SYSTICK_MAX_TICKS                    (16777215UL)     /* The maximum number of ticks for SysTick. */
-#define SYSTICK_MILLIS_IN_SECOND             (1000.00)        /* The number milliseconds in one second.   */
+#define SYSTICK_MAX_TICKS                    (16777215UL)     /* The maximum number of ticks for SysTick.    */
+#define SYSTICK_MIN_COUNTS                   (2UL)            /* The minimum counts of an interval.          */
+#define SYSTICK_MILLIS_IN_SECOND             (1000UL)         /* The number milliseconds in one second.      */
+#define SYSTICK_MICROS_IN_SECOND             (1000000UL)      /* The number microseconds in one second.      */
+#define SYSTICK_NANOS_IN_SECOND              (1000000000ULL)  /* The number nanoseconds in one second.       */
+#define SYSTICK_MICROS_IN_MILLI              (1000UL)         /* The number microseconds in one millisecond. */
+#define SYSTICK_TIMEBASE_TICKS_PER_SECOND    (1000UL)         /* The timebase interrupt rate [1 ms tick].    */
+
+/* The index used to mark the end of the software timers list. */
+#define SYSTICK_NO_SOFTWARE_TIMER            (0XFFFFU)
+
+/* The processor cycles the timebase counter is stopped for while the tickless idle corrects it [estimated]. */
+#define SYSTICK_STOPPED_COUNTER_CYCLES       (48UL)
+
+/* The value of the nanoseconds delay overhead before it is measured. */
+#define SYSTICK_UNCALIBRATED_OVERHEAD        (0XFFFFFFFFUL)
 
 /*=====================================================================================================================
                                        < User-defined Data Types >
@@ -29,8 +43,26 @@ typedef enum
     SYSTICK_BUSY_WAIT_MODE,                  /* SysTick is running in a busy wait.                   */
     SYSTICK_SINGLE_INTERVAL_MODE,            /* SysTick is running and counting a single interval.   */
     SYSTICK_PERIODIC_INTERVAL_MODE,          /* SysTick is running and counting a periodic interval. */
+    SYSTICK_TIMEBASE_MODE,                   /* SysTick is running as a free-running timebase.       */
 }SYSTICK_currentModeType;
 
+typedef enum
+{
+    SYSTICK_FREE_TIMER,                      /* The software timer is not created.                   */
+    SYSTICK_IDLE_TIMER,                      /* The software timer is created and stopped.           */
+    SYSTICK_ACTIVE_TIMER,                    /* The software timer is running in the timers list.    */
+}SYSTICK_softwareTimerStateType;
+
+typedef struct
+{
+    void (*ptr2callBackFunction)(void);      /* Pointer to the call-back function of the timer.                  */
+    uint32 delta;                            /* The ticks remaining after the expiry of the previous timer.      */
+    uint32 period;                           /* The reload period of a periodic timer [0 for one-shot timers].   */
+    uint16 next;                             /* The index of the next timer in the list [or the free pool].      */
+    uint16 previous;                         /* The index of the previous timer in the list.                     */
+    SYSTICK_softwareTimerStateType state;    /* The state of the software timer.                                 */
+}SYSTICK_softwareTimerType;
+
 typedef struct
 {
     volatile uint32 CTRL;                    /* SysTick Control and Status Register. */
@@ -52,11 +84,24 @@ typedef struct
 #define SYSTICK_CTRL_CLKSOURCE_BIT           (2)
 #define SYSTICK_CTRL_COUNTFLAG_BIT           (16)
 
+/* The Interrupt Control and State Register of the SCB, its PENDSTSET bit shows a pending SysTick exception. */
+#define SYSTICK_SCB_ICSR                     (*((volatile uint32*)0XE000ED04))
+#define SYSTICK_SCB_ICSR_PENDSTSET_BIT       (26)
+
 /*=====================================================================================================================
                                          < Function-like Macros >
 =====================================================================================================================*/
 
-/* Macro used to calculate the total number of ticks needed for a specific time interval. */
-#define SYSTICK_GET_TICKS_COUNT(INTERVAL) (((uint32)((INTERVAL / SYSTICK_MILLIS_IN_SECOND) * G_timerFrequency)) - 1)
+/* Complete the pending memory accesses, then sleep until an interrupt is pending [even if it is masked]. */
+#define SYSTICK_WAIT_FOR_INTERRUPT()      __asm volatile ("dsb\n\twfi\n\tisb" ::: "memory")
+
+/* Read the active exception number [IPSR], the interrupts mask [PRIMASK] and the priority mask [BASEPRI]. */
+#define SYSTICK_GET_IPSR(VALUE)           __asm volatile ("MRS %0, IPSR" : "=r" (VALUE))
+#define SYSTICK_GET_PRIMASK(VALUE)        __asm volatile ("MRS %0, PRIMASK" : "=r" (VALUE))
+#define SYSTICK_GET_BASEPRI(VALUE)        __asm volatile ("MRS %0, BASEPRI" : "=r" (VALUE))
+
+/* Get the CPU cycles elapsed since the counter reached zero [the processor clock or the processor clock / 8]. */
+#define SYSTICK_GET_INTERRUPT_LATENCY()   ((SYSTICK->LOAD - SYSTICK->VAL) * \
+                                           (BIT_IS_SET(SYSTICK->CTRL,SYSTICK_CTRL_CLKSOURCE_BIT) ? 1UL : 8UL))
 
 #endif /* MCAL_SYSTICK_INCLUDES_SYSTICK_PRV_H_ */
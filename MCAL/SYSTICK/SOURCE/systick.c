@@ -18,19 +18,44 @@ Description  : Source file for the ARM Cortex-M4 SysTick peripheral driver.
 #include "../INCLUDES/systick_prv.h"
 #include "../INCLUDES/systick_cfg.h"
 #include "../INCLUDES/systick.h"
+#include "../../RCC/INCLUDES/rcc.h"
+#include "../../DWT/INCLUDES/dwt.h"
 
 /*=====================================================================================================================
                                            < Global Variables >
 =====================================================================================================================*/
 
-static uint32 G_timerFrequency = CPU_CLOCK;                                 /* SysTick clock frequency.           */
+static uint32 G_timerFrequency = 0;                                         /* SysTick clock frequency.           */
 static void (*G_ptr2callBackFunction)(void) = NULL_PTR;                     /* Pointer to the call-back function. */
 static SYSTICK_currentModeType G_systickCurrentMode = SYSTICK_NOT_RUNNING;  /* SysTick current operation mode.    */
+static volatile uint64 G_timebaseTicks = 0;                                /* The timebase elapsed milliseconds. */
+static uint32 G_intervalReloads = 1;                                       /* The reloads of the interval.       */
+static volatile uint32 G_remainingReloads = 1;                             /* The remaining reloads.             */
+static uint32 G_busyWaitOverheadCycles = SYSTICK_UNCALIBRATED_OVERHEAD;    /* The nanoseconds delay overhead.    */
+
+/* The static pool of the software timers, and the head of the active timers list sorted by their expiry. The delta of
+ * each timer in the list is relative to the timer before it, so every tick only decrements the head delta. */
+static SYSTICK_softwareTimerType G_softwareTimers[SYSTICK_NUMBER_OF_SOFTWARE_TIMERS] = {{NULL_PTR}};
+static volatile uint16 G_softwareTimersHead = SYSTICK_NO_SOFTWARE_TIMER;
 
 /*=====================================================================================================================
                                           < Functions Definitions >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_updateTimerFrequency
+ * [Description]   : Update the value of SysTick clock frequency from the current AHB clock in the RCC clock tree and
+ *                   the selected clock source, so the intervals stay correct after changing the system clock.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void SYSTICK_updateTimerFrequency(void)
+{
+    uint32 LOC_AHBClock = 0;
+    RCC_getBusClockFrequency(RCC_AHB1_BUS,&LOC_AHBClock);
+    G_timerFrequency = (BIT_IS_SET(SYSTICK->CTRL,SYSTICK_CTRL_CLKSOURCE_BIT) ? LOC_AHBClock : (LOC_AHBClock / 8));
+}
+
 /*=====================================================================================================================
  * [Function Name] : SYSTICK_init
  * [Description]   : Initialize SysTick by setting its clock source.
@@ -42,119 +67,699 @@ void SYSTICK_init(SYSTICK_clockSourceType a_clockSource)
     /* Set the required clock source for SysTick. */
     WRITE_BIT(SYSTICK->CTRL,SYSTICK_CTRL_CLKSOURCE_BIT,a_clockSource);
     /* Update the value of SysTick clock frequency. */
-    G_timerFrequency = ((a_clockSource == SYSTICK_CPU_CLOCK) ? CPU_CLOCK : (CPU_CLOCK / 8));
+    SYSTICK_updateTimerFrequency();
 }
 
 /*=====================================================================================================================
- * [Function Name] : SYSTICK_setBusyWait
- * [Description]   : Set a blocking delay with a specific time interval.
- * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
+ * [Function Name] : SYSTICK_isTickServiced
+ * [Description]   : Check if the SysTick interrupt can run from the current context to advance the timebase, it can
+ *                   not run in an interrupt handler or while PRIMASK or BASEPRI masks the interrupts.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns TRUE if the SysTick interrupt can run, otherwise FALSE.
+ ====================================================================================================================*/
+static uint8 SYSTICK_isTickServiced(void)
+{
+    uint32 LOC_exceptionNumber = 0;
+    uint32 LOC_interruptsMask = 0;
+    uint32 LOC_priorityMask = 0;
+
+    SYSTICK_GET_IPSR(LOC_exceptionNumber);
+    SYSTICK_GET_PRIMASK(LOC_interruptsMask);
+    SYSTICK_GET_BASEPRI(LOC_priorityMask);
+
+    return (((LOC_exceptionNumber | LOC_interruptsMask | LOC_priorityMask) == 0) ? TRUE : FALSE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setInterval
+ * [Description]   : Start SysTick counting a specific time interval in a specific mode. Intervals longer than the 24-bit
+ *                   counter are split into equal reloads, and the interval ends after the last reload. A busy wait
+ *                   while the timebase is running waits on the timebase instead of taking SysTick. If the SysTick
+ *                   interrupt can not run [an interrupt handler, PRIMASK or BASEPRI is set] the timebase does not
+ *                   advance, so the busy wait counts the elapsed counts of the running counter itself. In that case
+ *                   the wait is extended by any handler that preempts it for longer than one tick.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value.
+ *                   <a_unitsPerSecond>    -> Indicates to the time interval units [1000: milliseconds - 1000000: micro].
+ *                   <a_mode>              -> Indicates to the required mode [Busy Wait - Single - Periodic].
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Busy Error.
- *                                                          - Overflow Error.
+ *                                                          - Time Interval Error.
  ====================================================================================================================*/
-SYSTICK_errorStatusType SYSTICK_setBusyWait(uint16 a_timeInterval)
+static SYSTICK_errorStatusType SYSTICK_setInterval(uint32 a_timeInterval, uint32 a_unitsPerSecond, SYSTICK_currentModeType a_mode)
 {
     SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_ERRORS;
+    uint64 LOC_counts = 0;
+    uint32 LOC_reloads = 0;
 
-    /* Calculate the maximum time interval for SysTick according to the current frequency. */
-    uint16 LOC_maxTimeInterval = ((SYSTICK_MAX_TICKS / G_timerFrequency) * SYSTICK_MILLIS_IN_SECOND);
+    /* Calculate the total counts of the interval according to the current frequency, and the number of reloads. */
+    SYSTICK_updateTimerFrequency();
+    LOC_counts = ((((uint64)a_timeInterval * G_timerFrequency) + (a_unitsPerSecond / 2UL)) / a_unitsPerSecond);
+    LOC_reloads = (uint32)((LOC_counts + SYSTICK_MAX_TICKS) / (SYSTICK_MAX_TICKS + 1UL));
 
-    if(G_systickCurrentMode != SYSTICK_NOT_RUNNING)
+    if((G_systickCurrentMode == SYSTICK_TIMEBASE_MODE) && (a_mode == SYSTICK_BUSY_WAIT_MODE) && (SYSTICK_isTickServiced() == FALSE))
+    {
+        uint32 LOC_previousValue = SYSTICK->VAL;
+        uint32 LOC_currentValue = 0;
+        uint64 LOC_elapsedCounts = 0;
+
+        /* Add the counts between every two readings of the down counter, including its wraps at the reloads. */
+        while(LOC_elapsedCounts < LOC_counts)
+        {
+            LOC_currentValue = SYSTICK->VAL;
+            if(LOC_currentValue <= LOC_previousValue)
+            {
+                LOC_elapsedCounts += (LOC_previousValue - LOC_currentValue);
+            }
+
+            else
+            {
+                LOC_elapsedCounts += (LOC_previousValue + (SYSTICK->LOAD + 1UL) - LOC_currentValue);
+            }
+            LOC_previousValue = LOC_currentValue;
+        }
+    }
+
+    else if((G_systickCurrentMode == SYSTICK_TIMEBASE_MODE) && (a_mode == SYSTICK_BUSY_WAIT_MODE))
+    {
+        uint64 LOC_startTime = SYSTICK_getMicros();
+        uint64 LOC_waitTime = (((uint64)a_timeInterval * SYSTICK_MICROS_IN_SECOND) / a_unitsPerSecond);
+
+        /* Wait until the time interval is elapsed on the running timebase. */
+        while((SYSTICK_getMicros() - LOC_startTime) < LOC_waitTime);
+    }
+
+    else if(G_systickCurrentMode != SYSTICK_NOT_RUNNING)
     {
         LOC_errorStatus = SYSTICK_BUSY_ERROR;
     }
 
-    else if(a_timeInterval > LOC_maxTimeInterval)
+    else if(LOC_counts < SYSTICK_MIN_COUNTS)
     {
-        LOC_errorStatus = SYSTICK_OVERFLOW_ERROR;
+        LOC_errorStatus = SYSTICK_TIME_INTERVAL_ERROR;
     }
 
     else
     {
-        G_systickCurrentMode = SYSTICK_BUSY_WAIT_MODE;               /* Change SysTick current mode.           */
-        SYSTICK->LOAD = SYSTICK_GET_TICKS_COUNT(a_timeInterval);     /* Calculate and Set the number of ticks. */
-        SYSTICK->VAL = 0;                                            /* Reset the Current Value Register.      */
-        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);              /* Enable SysTick counter.                */
+        G_systickCurrentMode = a_mode;                                          /* Change SysTick current mode.      */
+        G_intervalReloads = LOC_reloads;                                        /* Set the reloads of the interval.  */
+        G_remainingReloads = LOC_reloads;
+        SYSTICK->LOAD = ((uint32)(LOC_counts / LOC_reloads) - 1UL);             /* Set the counts of every reload.   */
+        SYSTICK->VAL = 0;                                                       /* Reset the Current Value Register. */
+
+        if(a_mode == SYSTICK_BUSY_WAIT_MODE)
+        {
+            SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);                     /* Enable SysTick counter.           */
+            /* Wait until every reload is elapsed and count flag is set to HIGH [the flag is cleared by reading it]. */
+            while(LOC_reloads--)
+            {
+                while(BIT_IS_CLEAR(SYSTICK->CTRL,SYSTICK_CTRL_COUNTFLAG_BIT));
+            }
+            /* Stop and Reset SysTick. */
+            SYSTICK_deinit();
+        }
 
-        /* Wait until the time interval is elapsed and count flag is set to HIGH. */
-        while(BIT_IS_CLEAR(SYSTICK->CTRL,SYSTICK_CTRL_COUNTFLAG_BIT));
-        /* Stop and Reset SysTick. */
-        SYSTICK_deinit();
+        else
+        {
+            SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_TICKINT_BIT);                    /* Enable SysTick interrupt.         */
+            SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);                     /* Enable SysTick counter.           */
+        }
     }
 
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setBusyWait
+ * [Description]   : Set a blocking delay with a specific time interval.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setBusyWait(uint32 a_timeInterval)
+{
+    return SYSTICK_setInterval(a_timeInterval,SYSTICK_MILLIS_IN_SECOND,SYSTICK_BUSY_WAIT_MODE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setBusyWaitMicros
+ * [Description]   : Set a blocking delay with a specific time interval in microseconds.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in microseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setBusyWaitMicros(uint32 a_timeInterval)
+{
+    return SYSTICK_setInterval(a_timeInterval,SYSTICK_MICROS_IN_SECOND,SYSTICK_BUSY_WAIT_MODE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setBusyWaitNanos
+ * [Description]   : Set a short blocking delay in nanoseconds on the DWT cycle counter, so it does not take SysTick.
+ *                   The cycles of the call itself are measured on the first call and subtracted from every delay,
+ *                   and the resolution is one CPU cycle.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in nanoseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setBusyWaitNanos(uint32 a_timeInterval)
+{
+    uint32 LOC_startCycles = 0;
+    uint32 LOC_AHBClock = 0;
+    uint32 LOC_cycles = 0;
+
+    DWT_enableCycleCounter();
+    LOC_startCycles = DWT_getCycleCount();
+
+    /* Calibrate the delay by measuring the cycles of a zero delay once. */
+    if(G_busyWaitOverheadCycles == SYSTICK_UNCALIBRATED_OVERHEAD)
+    {
+        G_busyWaitOverheadCycles = 0;
+        SYSTICK_setBusyWaitNanos(0);
+        G_busyWaitOverheadCycles = (DWT_getCycleCount() - LOC_startCycles);
+        LOC_startCycles = DWT_getCycleCount();
+    }
+
+    RCC_getBusClockFrequency(RCC_AHB1_BUS,&LOC_AHBClock);
+    LOC_cycles = (uint32)(((uint64)a_timeInterval * LOC_AHBClock) / SYSTICK_NANOS_IN_SECOND);
+    LOC_cycles = ((LOC_cycles > G_busyWaitOverheadCycles) ? (LOC_cycles - G_busyWaitOverheadCycles) : 0);
+
+    /* Wait until the cycles are elapsed, the unsigned difference is valid across the counter wrap-around. */
+    while((DWT_getCycleCount() - LOC_startCycles) < LOC_cycles);
+
+    return SYSTICK_NO_ERRORS;
+}
+
 /*=====================================================================================================================
  * [Function Name] : SYSTICK_setSingleInterval
  * [Description]   : Set a single non-blocking delay with a specific time interval.
  * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setSingleInterval(uint32 a_timeInterval)
+{
+    return SYSTICK_setInterval(a_timeInterval,SYSTICK_MILLIS_IN_SECOND,SYSTICK_SINGLE_INTERVAL_MODE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setSingleIntervalMicros
+ * [Description]   : Set a single non-blocking delay with a specific time interval in microseconds.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in microseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setSingleIntervalMicros(uint32 a_timeInterval)
+{
+    return SYSTICK_setInterval(a_timeInterval,SYSTICK_MICROS_IN_SECOND,SYSTICK_SINGLE_INTERVAL_MODE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setPeriodicInterval
+ * [Description]   : Set a periodic non-blocking delay with a specific time interval.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setPeriodicInterval(uint32 a_timeInterval)
+{
+    return SYSTICK_setInterval(a_timeInterval,SYSTICK_MILLIS_IN_SECOND,SYSTICK_PERIODIC_INTERVAL_MODE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_setPeriodicIntervalMicros
+ * [Description]   : Set a periodic non-blocking delay with a specific time interval in microseconds.
+ * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in microseconds].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_setPeriodicIntervalMicros(uint32 a_timeInterval)
+{
+    return SYSTICK_setInterval(a_timeInterval,SYSTICK_MICROS_IN_SECOND,SYSTICK_PERIODIC_INTERVAL_MODE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_readTimebase
+ * [Description]   : Read the timebase ticks count and the counter value as one consistent pair. If the counter has
+ *                   reloaded but its interrupt is still pending [interrupts disabled or a higher priority context],
+ *                   the pending tick is added and the counter is read again after its reload.
+ * [Arguments]     : <a_ptr2ticks>         -> Pointer to variable to store the elapsed ticks [milliseconds].
+ *                   <a_ptr2counterValue>  -> Pointer to variable to store the elapsed counts in the current tick.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void SYSTICK_readTimebase(uint64* a_ptr2ticks, uint32* a_ptr2counterValue)
+{
+    uint32 LOC_interruptsState = 0;
+
+    ENTER_CRITICAL_SECTION(LOC_interruptsState);
+    *a_ptr2ticks = G_timebaseTicks;
+    *a_ptr2counterValue = SYSTICK->VAL;
+    if(BIT_IS_SET(SYSTICK_SCB_ICSR,SYSTICK_SCB_ICSR_PENDSTSET_BIT))
+    {
+        *a_ptr2ticks += 1;
+        *a_ptr2counterValue = SYSTICK->VAL;
+    }
+    EXIT_CRITICAL_SECTION(LOC_interruptsState);
+
+    /* The counter counts down, so the elapsed counts = (Reload Value - Current Value). */
+    *a_ptr2counterValue = (SYSTICK->LOAD - *a_ptr2counterValue);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_startTimebase
+ * [Description]   : Start SysTick as a free-running 64-bit timebase with a 1 millisecond tick, the call-back function
+ *                   [if set] is called every tick. The timebase must be restarted after changing the AHB clock.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
  *                                                          - Overflow Error.
  ====================================================================================================================*/
-SYSTICK_errorStatusType SYSTICK_setSingleInterval(uint16 a_timeInterval)
+SYSTICK_errorStatusType SYSTICK_startTimebase(void)
 {
     SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_ERRORS;
 
-    /* Calculate the maximum time interval for SysTick according to the current frequency. */
-    uint16 LOC_maxTimeInterval = ((SYSTICK_MAX_TICKS / G_timerFrequency) * SYSTICK_MILLIS_IN_SECOND);
+    SYSTICK_updateTimerFrequency();
 
     if(G_systickCurrentMode != SYSTICK_NOT_RUNNING)
     {
         LOC_errorStatus = SYSTICK_BUSY_ERROR;
     }
 
-    else if(a_timeInterval > LOC_maxTimeInterval)
+    else if(((G_timerFrequency / SYSTICK_TIMEBASE_TICKS_PER_SECOND) == 0) || \
+            ((G_timerFrequency / SYSTICK_TIMEBASE_TICKS_PER_SECOND) > (SYSTICK_MAX_TICKS + 1UL)))
     {
         LOC_errorStatus = SYSTICK_OVERFLOW_ERROR;
     }
 
     else
     {
-        G_systickCurrentMode = SYSTICK_SINGLE_INTERVAL_MODE;         /* Change SysTick current mode.           */
-        SYSTICK->LOAD = SYSTICK_GET_TICKS_COUNT(a_timeInterval);     /* Calculate and Set the number of ticks. */
-        SYSTICK->VAL = 0;                                            /* Reset the Current Value Register.      */
-        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_TICKINT_BIT);             /* Enable SysTick interrupt.              */
-        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);              /* Enable SysTick counter.                */
+        G_systickCurrentMode = SYSTICK_TIMEBASE_MODE;                                  /* Change SysTick mode.    */
+        G_timebaseTicks = 0;                                                           /* Reset the ticks count.  */
+        SYSTICK->LOAD = ((G_timerFrequency / SYSTICK_TIMEBASE_TICKS_PER_SECOND) - 1);  /* Set a 1 ms tick.        */
+        SYSTICK->VAL = 0;                                                              /* Reset the counter.      */
+        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_TICKINT_BIT);                               /* Enable the interrupt.   */
+        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);                                /* Enable the counter.     */
     }
 
     return LOC_errorStatus;
 }
 
 /*=====================================================================================================================
- * [Function Name] : SYSTICK_setPeriodicInterval
- * [Description]   : Set a periodic non-blocking delay with a specific time interval.
- * [Arguments]     : <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
+ * [Function Name] : SYSTICK_stopCounter
+ * [Description]   : Stop the timebase counter and check if a tick has ended since the control register was last read.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns TRUE if the counter has reached zero [COUNTFLAG], otherwise FALSE.
+ ====================================================================================================================*/
+static uint8 SYSTICK_stopCounter(void)
+{
+    /* Reading the control register clears COUNTFLAG, so it is taken from the same read that stops the counter. */
+    uint32 LOC_control = SYSTICK->CTRL;
+    SYSTICK->CTRL = (LOC_control & ~(1UL << SYSTICK_CTRL_ENABLE_BIT));
+
+    /* The counter may reach zero between the read and the write, so COUNTFLAG is read again after it stops. */
+    LOC_control |= SYSTICK->CTRL;
+
+    return (BIT_IS_SET(LOC_control,SYSTICK_CTRL_COUNTFLAG_BIT) ? TRUE : FALSE);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_resumeCounter
+ * [Description]   : Restart the stopped timebase counter, so the current tick ends after a specific number of counts
+ *                   less the counts lost while the counter was stopped, then the normal ticks continue.
+ * [Arguments]     : <a_countsPerTick>     -> Indicates to the number of counts in one tick.
+ *                   <a_remainingCounts>   -> Indicates to the number of counts until the end of the current tick.
+ *                   <a_stoppedCounts>     -> Indicates to the number of counts lost while the counter was stopped.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void SYSTICK_resumeCounter(uint32 a_countsPerTick, uint32 a_remainingCounts, uint32 a_stoppedCounts)
+{
+    /* The lost counts are taken from the current tick, but it can not be shorter than the minimum counts. */
+    a_remainingCounts = ((a_remainingCounts >= (a_stoppedCounts + SYSTICK_MIN_COUNTS)) ? \
+                         (a_remainingCounts - a_stoppedCounts) : SYSTICK_MIN_COUNTS);
+
+    SYSTICK->LOAD = (a_remainingCounts - 1UL);
+    SYSTICK->VAL = 0;                                            /* Writing the counter also clears COUNTFLAG. */
+    SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);
+    /* The new reload value takes effect after the current tick, so the normal ticks continue after it. */
+    SYSTICK->LOAD = (a_countsPerTick - 1UL);
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_enterTicklessIdle
+ * [Description]   : Sleep until the next software timer deadline or any other interrupt without the 1 millisecond
+ *                   ticks, by reloading the timebase counter with the whole idle period, then correct the timebase
+ *                   and the software timers with the ticks elapsed in the sleep. It is called from the idle loop.
+ *                   While a call-back function is set, it sleeps with the normal ticks to call it every tick.
+ * [Arguments]     : The function takes no arguments.
  * [return]        : The function returns the error status: - No Errors.
- *                                                          - Busy Error.
- *                                                          - Overflow Error.
+ *                                                          - Mode Error.
  ====================================================================================================================*/
-SYSTICK_errorStatusType SYSTICK_setPeriodicInterval(uint16 a_timeInterval)
+SYSTICK_errorStatusType SYSTICK_enterTicklessIdle(void)
 {
     SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+    uint32 LOC_countsPerTick = (SYSTICK->LOAD + 1UL);
+    uint32 LOC_maxIdleTicks = ((SYSTICK_MAX_TICKS + 1UL) / LOC_countsPerTick);
+    uint32 LOC_idleTicks = LOC_maxIdleTicks;
+    uint32 LOC_stoppedCounts = 0;
+    uint32 LOC_elapsedCounts = 0;
+    uint32 LOC_remainingCounts = 0;
+    uint32 LOC_elapsedTicks = 0;
+
+    if(G_systickCurrentMode != SYSTICK_TIMEBASE_MODE)
+    {
+        LOC_errorStatus = SYSTICK_MODE_ERROR;
+    }
+
+    else
+    {
+        /* The interrupts stay masked in the sleep, a pending interrupt wakes the core and runs after the correction. */
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
 
-    /* Calculate the maximum time interval for SysTick according to the current frequency. */
-    uint16 LOC_maxTimeInterval = ((SYSTICK_MAX_TICKS / G_timerFrequency) * SYSTICK_MILLIS_IN_SECOND);
+        /* The idle period ends at the nearest software timer deadline. */
+        if((G_softwareTimersHead != SYSTICK_NO_SOFTWARE_TIMER) && ((G_softwareTimers + G_softwareTimersHead)->delta < LOC_idleTicks))
+        {
+            LOC_idleTicks = (G_softwareTimers + G_softwareTimersHead)->delta;
+        }
 
-    if(G_systickCurrentMode != SYSTICK_NOT_RUNNING)
+        /* This read of the control register clears COUNTFLAG, so the flag is set only by the ticks ending from now. */
+        LOC_stoppedCounts = (BIT_IS_SET(SYSTICK->CTRL,SYSTICK_CTRL_CLKSOURCE_BIT) ? \
+                             SYSTICK_STOPPED_COUNTER_CYCLES : (SYSTICK_STOPPED_COUNTER_CYCLES / 8UL));
+
+        if((LOC_idleTicks < 2) || BIT_IS_SET(SYSTICK_SCB_ICSR,SYSTICK_SCB_ICSR_PENDSTSET_BIT) || \
+           (G_ptr2callBackFunction != NULL_PTR))
+        {
+            /* The next tick is due or the call-back function needs every tick, so sleep with the normal ticks. */
+            SYSTICK_WAIT_FOR_INTERRUPT();
+        }
+
+        else if((SYSTICK_stopCounter() == TRUE) || BIT_IS_SET(SYSTICK_SCB_ICSR,SYSTICK_SCB_ICSR_PENDSTSET_BIT))
+        {
+            /* A tick has ended before the counter stopped, so finish the next tick and sleep with the normal ticks. */
+            SYSTICK_resumeCounter(LOC_countsPerTick,((SYSTICK->VAL == 0) ? LOC_countsPerTick : SYSTICK->VAL),LOC_stoppedCounts);
+            SYSTICK_WAIT_FOR_INTERRUPT();
+        }
+
+        else
+        {
+            /* The counter reaches zero after the rest of the current tick [its value] plus the whole idle ticks. */
+            SYSTICK_resumeCounter(LOC_countsPerTick,(SYSTICK->VAL + (LOC_countsPerTick * (LOC_idleTicks - 1UL))),LOC_stoppedCounts);
+
+            SYSTICK_WAIT_FOR_INTERRUPT();
+
+            /* Stop the counter, so the idle period can not end while the elapsed counts are calculated. */
+            if(SYSTICK_stopCounter() == TRUE)
+            {
+                /* The idle period has ended and the counter has reloaded a normal tick, the pending SysTick interrupt
+                 * counts the last idle tick. */
+                LOC_elapsedTicks = (LOC_idleTicks - 1UL);
+                LOC_remainingCounts = ((SYSTICK->VAL == 0) ? LOC_countsPerTick : SYSTICK->VAL);
+            }
+
+            else
+            {
+                /* Another interrupt has ended the sleep, the counts elapsed since the start of the interrupted tick
+                 * are the whole idle period less the counts remaining in it [the stopped counts are compensated]. */
+                LOC_elapsedCounts = ((LOC_countsPerTick * LOC_idleTicks) - SYSTICK->VAL);
+                LOC_elapsedTicks = (LOC_elapsedCounts / LOC_countsPerTick);
+                LOC_remainingCounts = (LOC_countsPerTick - (LOC_elapsedCounts % LOC_countsPerTick));
+            }
+
+            /* Count the elapsed ticks, then finish the current tick [its remaining counts] with the normal ticks. */
+            G_timebaseTicks += LOC_elapsedTicks;
+            if(G_softwareTimersHead != SYSTICK_NO_SOFTWARE_TIMER) (G_softwareTimers + G_softwareTimersHead)->delta -= LOC_elapsedTicks;
+            SYSTICK_resumeCounter(LOC_countsPerTick,LOC_remainingCounts,LOC_stoppedCounts);
+        }
+
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_getMillis
+ * [Description]   : Get the number of milliseconds elapsed since the timebase has started.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the elapsed time in milliseconds.
+ ====================================================================================================================*/
+uint64 SYSTICK_getMillis(void)
+{
+    uint64 LOC_ticks = 0;
+    uint32 LOC_counterValue = 0;
+
+    SYSTICK_readTimebase(&LOC_ticks,&LOC_counterValue);
+
+    return LOC_ticks;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_getMicros
+ * [Description]   : Get the number of microseconds elapsed since the timebase has started, calculated from the ticks
+ *                   count and the current value of the counter.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns the elapsed time in microseconds.
+ ====================================================================================================================*/
+uint64 SYSTICK_getMicros(void)
+{
+    uint64 LOC_ticks = 0;
+    uint32 LOC_counterValue = 0;
+
+    SYSTICK_readTimebase(&LOC_ticks,&LOC_counterValue);
+
+    /* Microseconds = (Ticks * 1000) + ((Elapsed Counts * 1000) / Counts per Tick). */
+    return ((LOC_ticks * SYSTICK_MICROS_IN_MILLI) + ((LOC_counterValue * SYSTICK_MICROS_IN_MILLI) / (SYSTICK->LOAD + 1UL)));
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_insertSoftwareTimer
+ * [Description]   : Insert a software timer in the active timers list at the position of its expiry, the function
+ *                   must be called with the interrupts disabled or from the SysTick interrupt.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ *                   <a_ticks>             -> Indicates to the number of ticks until the timer expires.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void SYSTICK_insertSoftwareTimer(uint16 a_timerID, uint32 a_ticks)
+{
+    uint16 LOC_previous = SYSTICK_NO_SOFTWARE_TIMER;
+    uint16 LOC_current = G_softwareTimersHead;
+
+    /* Skip the timers expiring before or with the new timer, the new timer is placed after the equal ones. */
+    while((LOC_current != SYSTICK_NO_SOFTWARE_TIMER) && (a_ticks >= (G_softwareTimers + LOC_current)->delta))
     {
-        LOC_errorStatus = SYSTICK_BUSY_ERROR;
+        a_ticks -= (G_softwareTimers + LOC_current)->delta;
+        LOC_previous = LOC_current;
+        LOC_current = (G_softwareTimers + LOC_current)->next;
     }
 
-    else if(a_timeInterval > LOC_maxTimeInterval)
+    (G_softwareTimers + a_timerID)->delta = a_ticks;
+    (G_softwareTimers + a_timerID)->previous = LOC_previous;
+    (G_softwareTimers + a_timerID)->next = LOC_current;
+    (G_softwareTimers + a_timerID)->state = SYSTICK_ACTIVE_TIMER;
+
+    if(LOC_current != SYSTICK_NO_SOFTWARE_TIMER)
     {
-        LOC_errorStatus = SYSTICK_OVERFLOW_ERROR;
+        (G_softwareTimers + LOC_current)->delta -= a_ticks;
+        (G_softwareTimers + LOC_current)->previous = a_timerID;
+    }
+
+    if(LOC_previous == SYSTICK_NO_SOFTWARE_TIMER) G_softwareTimersHead = a_timerID;
+    else (G_softwareTimers + LOC_previous)->next = a_timerID;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_removeSoftwareTimer
+ * [Description]   : Remove an active software timer from the active timers list, the function must be called with
+ *                   the interrupts disabled or from the SysTick interrupt.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void SYSTICK_removeSoftwareTimer(uint16 a_timerID)
+{
+    uint16 LOC_previous = (G_softwareTimers + a_timerID)->previous;
+    uint16 LOC_next = (G_softwareTimers + a_timerID)->next;
+
+    /* The next timer takes the remaining delta of the removed timer to keep its expiry time. */
+    if(LOC_next != SYSTICK_NO_SOFTWARE_TIMER)
+    {
+        (G_softwareTimers + LOC_next)->delta += (G_softwareTimers + a_timerID)->delta;
+        (G_softwareTimers + LOC_next)->previous = LOC_previous;
+    }
+
+    if(LOC_previous == SYSTICK_NO_SOFTWARE_TIMER) G_softwareTimersHead = LOC_next;
+    else (G_softwareTimers + LOC_previous)->next = LOC_next;
+
+    (G_softwareTimers + a_timerID)->state = SYSTICK_IDLE_TIMER;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_processSoftwareTimers
+ * [Description]   : Count one tick for the software timers, then expire the timers at the head of the list. Periodic
+ *                   timers are inserted again before calling their call-back functions, so they can stop themselves.
+ * [Arguments]     : The function takes no arguments.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void SYSTICK_processSoftwareTimers(void)
+{
+    uint16 LOC_timerID = G_softwareTimersHead;
+
+    if(LOC_timerID != SYSTICK_NO_SOFTWARE_TIMER)
+    {
+        (G_softwareTimers + LOC_timerID)->delta--;
+
+        while((G_softwareTimersHead != SYSTICK_NO_SOFTWARE_TIMER) && ((G_softwareTimers + G_softwareTimersHead)->delta == 0))
+        {
+            LOC_timerID = G_softwareTimersHead;
+            SYSTICK_removeSoftwareTimer(LOC_timerID);
+
+            if((G_softwareTimers + LOC_timerID)->period != 0)
+            {
+                SYSTICK_insertSoftwareTimer(LOC_timerID,(G_softwareTimers + LOC_timerID)->period);
+            }
+
+            if((G_softwareTimers + LOC_timerID)->ptr2callBackFunction != NULL_PTR)
+            {
+                (G_softwareTimers + LOC_timerID)->ptr2callBackFunction();
+            }
+        }
+    }
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_createSoftwareTimer
+ * [Description]   : Allocate a software timer from the static pool, the software timers are counted by the timebase
+ *                   ticks [SYSTICK_startTimebase] and their call-back functions are called from the SysTick interrupt.
+ * [Arguments]     : <a_ptr2callBackFunction>  -> Pointer to the call-back function of the timer.
+ *                   <a_ptr2timerID>           -> Pointer to variable to store the ID of the created timer.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Null Pointer Error.
+ *                                                          - No Free Timer Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_createSoftwareTimer(void (*a_ptr2callBackFunction)(void), uint16* a_ptr2timerID)
+{
+    SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_FREE_TIMER_ERROR;
+    uint32 LOC_interruptsState = 0;
+    uint16 LOC_timerID = 0;
+
+    if((a_ptr2callBackFunction == NULL_PTR) || (a_ptr2timerID == NULL_PTR))
+    {
+        LOC_errorStatus = SYSTICK_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        for(LOC_timerID = 0; LOC_timerID < SYSTICK_NUMBER_OF_SOFTWARE_TIMERS; LOC_timerID++)
+        {
+            if((G_softwareTimers + LOC_timerID)->state == SYSTICK_FREE_TIMER)
+            {
+                (G_softwareTimers + LOC_timerID)->ptr2callBackFunction = a_ptr2callBackFunction;
+                (G_softwareTimers + LOC_timerID)->state = SYSTICK_IDLE_TIMER;
+                *a_ptr2timerID = LOC_timerID;
+                LOC_errorStatus = SYSTICK_NO_ERRORS;
+                break;
+            }
+        }
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_startSoftwareTimer
+ * [Description]   : Start [or restart] a software timer to expire after a specific time interval.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ *                   <a_timeInterval>      -> Indicates to the required time interval value [in milliseconds].
+ *                   <a_timerMode>         -> Indicates to the required timer mode [One-Shot - Periodic].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Timer ID Error.
+ *                                                          - Time Interval Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_startSoftwareTimer(uint16 a_timerID, uint32 a_timeInterval, SYSTICK_softwareTimerModeType a_timerMode)
+{
+    SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if((a_timerID >= SYSTICK_NUMBER_OF_SOFTWARE_TIMERS) || ((G_softwareTimers + a_timerID)->state == SYSTICK_FREE_TIMER))
+    {
+        LOC_errorStatus = SYSTICK_TIMER_ID_ERROR;
+    }
+
+    else if((a_timeInterval == 0) || ((a_timerMode != SYSTICK_ONE_SHOT_TIMER) && (a_timerMode != SYSTICK_PERIODIC_TIMER)))
+    {
+        LOC_errorStatus = SYSTICK_TIME_INTERVAL_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        if((G_softwareTimers + a_timerID)->state == SYSTICK_ACTIVE_TIMER) SYSTICK_removeSoftwareTimer(a_timerID);
+        (G_softwareTimers + a_timerID)->period = ((a_timerMode == SYSTICK_PERIODIC_TIMER) ? a_timeInterval : 0);
+        SYSTICK_insertSoftwareTimer(a_timerID,a_timeInterval);
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_stopSoftwareTimer
+ * [Description]   : Stop a running software timer, the timer keeps its ID and can be started again.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Timer ID Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_stopSoftwareTimer(uint16 a_timerID)
+{
+    SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if((a_timerID >= SYSTICK_NUMBER_OF_SOFTWARE_TIMERS) || ((G_softwareTimers + a_timerID)->state == SYSTICK_FREE_TIMER))
+    {
+        LOC_errorStatus = SYSTICK_TIMER_ID_ERROR;
+    }
+
+    else
+    {
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        if((G_softwareTimers + a_timerID)->state == SYSTICK_ACTIVE_TIMER) SYSTICK_removeSoftwareTimer(a_timerID);
+        (G_softwareTimers + a_timerID)->period = 0;
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : SYSTICK_deleteSoftwareTimer
+ * [Description]   : Stop a software timer and return it to the static pool.
+ * [Arguments]     : <a_timerID>           -> Indicates to the ID of the required software timer.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Timer ID Error.
+ ====================================================================================================================*/
+SYSTICK_errorStatusType SYSTICK_deleteSoftwareTimer(uint16 a_timerID)
+{
+    SYSTICK_errorStatusType LOC_errorStatus = SYSTICK_NO_ERRORS;
+    uint32 LOC_interruptsState = 0;
+
+    if((a_timerID >= SYSTICK_NUMBER_OF_SOFTWARE_TIMERS) || ((G_softwareTimers + a_timerID)->state == SYSTICK_FREE_TIMER))
+    {
+        LOC_errorStatus = SYSTICK_TIMER_ID_ERROR;
     }
 
     else
     {
-        G_systickCurrentMode = SYSTICK_PERIODIC_INTERVAL_MODE;       /* Change SysTick current mode.           */
-        SYSTICK->LOAD = SYSTICK_GET_TICKS_COUNT(a_timeInterval);     /* Calculate and Set the number of ticks. */
-        SYSTICK->VAL = 0;                                            /* Reset the Current Value Register.      */
-        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_TICKINT_BIT);             /* Enable SysTick interrupt.              */
-        SET_BIT(SYSTICK->CTRL,SYSTICK_CTRL_ENABLE_BIT);              /* Enable SysTick counter.                */
+        ENTER_CRITICAL_SECTION(LOC_interruptsState);
+        if((G_softwareTimers + a_timerID)->state == SYSTICK_ACTIVE_TIMER) SYSTICK_removeSoftwareTimer(a_timerID);
+        (G_softwareTimers + a_timerID)->period = 0;
+        (G_softwareTimers + a_timerID)->ptr2callBackFunction = NULL_PTR;
+        (G_softwareTimers + a_timerID)->state = SYSTICK_FREE_TIMER;
+        EXIT_CRITICAL_SECTION(LOC_interruptsState);
     }
 
     return LOC_errorStatus;
@@ -232,12 +837,31 @@ void SYSTICK_deinit(void)
  ====================================================================================================================*/
 void SysTick_Handler(void)
 {
-    if(G_ptr2callBackFunction != NULL_PTR)
+    /* The counter is reloaded on the request, so the counts since the reload are the latency of the handler. */
+    DWT_ISR_ENTER_WITH_LATENCY(SYSTICK_GET_INTERRUPT_LATENCY());
+
+    if(G_systickCurrentMode == SYSTICK_TIMEBASE_MODE)
     {
-        G_ptr2callBackFunction();                                              /* Call the call-back function. */
+        G_timebaseTicks++;                                          /* Count the elapsed timebase milliseconds. */
+        SYSTICK_processSoftwareTimers();                            /* Count the tick for the software timers.  */
+        if(G_ptr2callBackFunction != NULL_PTR) G_ptr2callBackFunction();
+    }
+
+    /* The interval ends after its last reload, then the reloads are counted again for the periodic interval. */
+    else if((--G_remainingReloads) == 0)
+    {
+        G_remainingReloads = G_intervalReloads;
+
+        if(G_ptr2callBackFunction != NULL_PTR)
+        {
+            G_ptr2callBackFunction();                                          /* Call the call-back function. */
+        }
+
         if(G_systickCurrentMode == SYSTICK_SINGLE_INTERVAL_MODE)
         {
             SYSTICK_deinit();                  /* If SysTick current mode is Single Interval, Deinitialize it. */
         }
     }
+
+    DWT_ISR_EXIT();
 }
@@ -12,6 +12,13 @@ Description  : Interface file for the STM32F401xx UART peripheral driver.
 #ifndef MCAL_UART_INCLUDES_UART_H_
 #define MCAL_UART_INCLUDES_UART_H_
 
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* The bit set in the baud rate divider when the 8x oversampling is required [above the 16-bit BRR value]. */
+#define UART_OVERSAMPLING_BY_8_FLAG          (0X10000UL)
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
@@ -24,6 +31,9 @@ typedef enum
     UART_BAUD_RATE_ERROR,                /* Invalid Baud Rate Error.     */
     UART_DEVICE_MODE_ERROR,              /* Invalid Device Mode Error.   */
     UART_PARITY_STATUS_ERROR,            /* Invalid Parity Status Error. */
+    UART_BUSY_ERROR,                     /* Transmitter Busy Error.      */
+    UART_TRANSFER_ERROR,                 /* DMA Transfer Error.          */
+    UART_BUFFER_SIZE_ERROR,              /* Invalid Buffer Size Error.   */
 }UART_errorStatusType;
 
 typedef enum
@@ -54,6 +64,27 @@ typedef struct
     UART_parityStatusType parityStatus;  /* Parity Status [Disabled - Even Parity - Odd Parity]. */
 }UART_configurationsType;
 
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/* Get the nearest integer value of [UART clock / baud rate], which equals USARTDIV multiplied by the oversampling. */
+#define UART_CLOCK_DIVIDER(CLOCK,BAUD)              ((((uint32)(CLOCK)) + ((uint32)(BAUD) >> 1)) / (uint32)(BAUD))
+
+/* Check if a specific baud rate can be generated from a specific UART clock [USARTDIV >= 1 with 8x oversampling]. */
+#define UART_BAUD_RATE_IS_ACHIEVABLE(CLOCK,BAUD)    ((UART_CLOCK_DIVIDER(CLOCK,BAUD) >= 8UL) && (UART_CLOCK_DIVIDER(CLOCK,BAUD) <= 0XFFFFUL))
+
+/* Get the baud rate divider [BRR value in bits 0:15 + UART_OVERSAMPLING_BY_8_FLAG], the 16x oversampling is used
+ * whenever the divider allows it, otherwise the 3-bit fraction of the 8x oversampling is used. With constant
+ * arguments the macro is resolved by the compiler into a literal for UART_setBaudRateDivider. */
+#define UART_BAUD_RATE_DIVIDER(CLOCK,BAUD)          ((UART_CLOCK_DIVIDER(CLOCK,BAUD) >= 16UL) ? UART_CLOCK_DIVIDER(CLOCK,BAUD) : \
+                                                    (UART_OVERSAMPLING_BY_8_FLAG | ((UART_CLOCK_DIVIDER(CLOCK,BAUD) >> 3) << 4) | \
+                                                    (UART_CLOCK_DIVIDER(CLOCK,BAUD) & 0X07UL)))
+
+/* Get the error of the generated baud rate from the required baud rate in parts per million. */
+#define UART_BAUD_RATE_ERROR_PPM(CLOCK,BAUD)        ((sint32)(((((sint64)(CLOCK)) - ((sint64)UART_CLOCK_DIVIDER(CLOCK,BAUD) * (sint64)(BAUD))) * 1000000LL) / \
+                                                    ((sint64)UART_CLOCK_DIVIDER(CLOCK,BAUD) * (sint64)(BAUD))))
+
 /*=====================================================================================================================
                                          < Functions Prototypes >
 =====================================================================================================================*/
@@ -79,6 +110,7 @@ UART_errorStatusType UART_init(UART_peripheralIndexType a_peripheralIndex, UART_
  *                   <a_byte>             -> Indicates to the required byte to be sent.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Index Error.
+ *                                                          - Busy Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_sendByte(UART_peripheralIndexType a_peripheralIndex, uint8 a_byte);
 
@@ -96,12 +128,15 @@ UART_errorStatusType UART_receiveByte(UART_peripheralIndexType a_peripheralIndex
 /*=====================================================================================================================
  * [Function Name] : UART_sendBuffer
  * [Description]   : Send a specific buffer with a specific size using a specific UART peripheral.
+ *                   In the DMA transmit mode, the function starts the transfer and returns at once, and the buffer
+ *                   must stay valid until the transmit call-back function is called.
  * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
  *                   <a_ptr2buffer>       -> Pointer to the required buffer to be sent.
  *                   <a_bufferSize>       -> Indicates to the buffer size.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Index Error.
  *                                                          - Null Pointer Error.
+ *                                                          - Busy Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_sendBuffer(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint8 a_bufferSize);
 
@@ -120,11 +155,14 @@ UART_errorStatusType UART_receiveBuffer(UART_peripheralIndexType a_peripheralInd
 /*=====================================================================================================================
  * [Function Name] : UART_sendString
  * [Description]   : Send a specific string using a specific UART peripheral.
+ *                   In the DMA transmit mode, the function starts the transfer and returns at once, and the string
+ *                   must stay valid until the transmit call-back function is called.
  * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
  *                   <a_ptr2string>       -> Pointer to the required string to be sent.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Index Error.
  *                                                          - Null Pointer Error.
+ *                                                          - Busy Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_sendString(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2string);
 
@@ -139,6 +177,31 @@ UART_errorStatusType UART_sendString(UART_peripheralIndexType a_peripheralIndex,
  ====================================================================================================================*/
 UART_errorStatusType UART_receiveString(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer);
 
+/*=====================================================================================================================
+ * [Function Name] : UART_setBaudRateDivider
+ * [Description]   : Set a precomputed baud rate divider for a specific UART peripheral, the divider is usually a
+ *                   literal generated at compile time by UART_BAUD_RATE_DIVIDER, so no division is done at runtime.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_divider>          -> Indicates to the baud rate divider [BRR value + oversampling flag].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Baud Rate Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_setBaudRateDivider(UART_peripheralIndexType a_peripheralIndex, uint32 a_divider);
+
+/*=====================================================================================================================
+ * [Function Name] : UART_getBaudRateError
+ * [Description]   : Get the error of the baud rate generated by UART_init from the required baud rate, the error is
+ *                   unknown after UART_setBaudRateDivider until the next UART_init.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_ptr2error>        -> Pointer to variable to store the error in parts per million.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ *                                                          - Baud Rate Error [Unknown Error].
+ ====================================================================================================================*/
+UART_errorStatusType UART_getBaudRateError(UART_peripheralIndexType a_peripheralIndex, sint32* a_ptr2error);
+
 #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT)
 /*=====================================================================================================================
  * [Function Name] : UART_setCallBackFunction
@@ -152,4 +215,79 @@ UART_errorStatusType UART_receiveString(UART_peripheralIndexType a_peripheralInd
 UART_errorStatusType UART_setCallBackFunction(UART_peripheralIndexType a_peripheralIndex, void (*a_ptr2callBackFunction)(uint8));
 #endif
 
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER)
+/*=====================================================================================================================
+ * [Function Name] : UART_writeBuffer
+ * [Description]   : Copy as many bytes as fit from a specific buffer into the transmit ring buffer of a specific
+ *                   UART peripheral without waiting, the bytes are sent later by the TXE interrupt.
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>           -> Pointer to the required buffer to be sent.
+ *                   <a_bufferSize>           -> Indicates to the buffer size.
+ *                   <a_ptr2writtenBytes>     -> Pointer to variable to store the number of the written bytes.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_writeBuffer(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize, uint16* a_ptr2writtenBytes);
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER)
+/*=====================================================================================================================
+ * [Function Name] : UART_readBuffer
+ * [Description]   : Copy up to a specific number of the received bytes from the receive ring buffer of a specific
+ *                   UART peripheral into a specific buffer without waiting.
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>           -> Pointer to a buffer to store the received data.
+ *                   <a_bufferSize>           -> Indicates to the buffer size.
+ *                   <a_ptr2readBytes>        -> Pointer to variable to store the number of the read bytes.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_readBuffer(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize, uint16* a_ptr2readBytes);
+#endif
+
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+/*=====================================================================================================================
+ * [Function Name] : UART_setTransmitCallBackFunction
+ * [Description]   : Set the address of the call-back function that is called when the DMA transmission ends.
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2callBackFunction> -> Pointer to the call-back function [takes the transmission status].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_setTransmitCallBackFunction(UART_peripheralIndexType a_peripheralIndex, void (*a_ptr2callBackFunction)(UART_errorStatusType));
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA)
+/*=====================================================================================================================
+ * [Function Name] : UART_startFrameReception
+ * [Description]   : Start receiving into a specific buffer using a circular DMA transfer. The received data is
+ *                   delivered in place to the frame call-back function on each idle line and each half of the buffer.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>       -> Pointer to the circular buffer [must stay valid during the reception].
+ *                   <a_bufferSize>       -> Indicates to the buffer size.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ *                                                          - Buffer Size Error.
+ *                                                          - Transfer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_startFrameReception(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize);
+
+/*=====================================================================================================================
+ * [Function Name] : UART_setFrameCallBackFunction
+ * [Description]   : Set the address of the call-back function that receives the spans of the received frames.
+ *                   The call-back function takes a pointer to the span inside the circular buffer, the span length
+ *                   and a flag that is TRUE when the span is the end of a frame [the line became idle].
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2callBackFunction> -> Pointer to the call-back function.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_setFrameCallBackFunction(UART_peripheralIndexType a_peripheralIndex, void (*a_ptr2callBackFunction)(uint8*, uint16, uint8));
+#endif
+
 #endif /* MCAL_UART_INCLUDES_UART_H_ */
@@ -19,10 +19,23 @@ Description  : Configuration file for the STM32F401xx UART peripheral driver.
 /*=====================================================================================================================
 Set the UART receive mode with one of these options: 1- UART_RECEIVE_USING_POLLING
                                                      2- UART_RECEIVE_USING_INTERRUPT
+                                                     3- UART_RECEIVE_USING_RING_BUFFER
+                                                     4- UART_RECEIVE_USING_DMA
+In the DMA mode, the received data is delivered as frames through the frame call-back function only, and the UART
+and its DMA stream interrupts must be enabled by the application with the same priority.
 =====================================================================================================================*/
 #define UART_RECEIVE_MODE                    (UART_RECEIVE_USING_POLLING)
 
-/* Set the UART clock frequency [APB clock]. */
-#define UART_CLOCK_FREQUECY                  (16000000UL)
+/*=====================================================================================================================
+Set the UART transmit mode with one of these options: 1- UART_TRANSMIT_USING_POLLING
+                                                      2- UART_TRANSMIT_USING_DMA
+                                                      3- UART_TRANSMIT_USING_RING_BUFFER
+In the DMA mode, the DMA controllers clocks and the used DMA streams interrupts must be enabled by the application.
+=====================================================================================================================*/
+#define UART_TRANSMIT_MODE                   (UART_TRANSMIT_USING_POLLING)
+
+/* Set the size of the transmit and the receive ring buffers of each UART [must be a power of two]. */
+#define UART_TRANSMIT_RING_BUFFER_SIZE       (64U)
+#define UART_RECEIVE_RING_BUFFER_SIZE        (64U)
 
 #endif /* MCAL_UART_INCLUDES_UART_CFG_H_ */
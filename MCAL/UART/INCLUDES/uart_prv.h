@@ -19,17 +19,24 @@ Description  : Private file for the STM32F401xx UART peripheral driver.
 /* The number of UART peripherals in the chip. */
 #define UART_NUMBER_OF_UART_PERIPHERALS                    (3U)
 
-/* The number of samples taken for each bit in UART. */
-#define UART_OVERSAMPLING_VALUE                            (16U)
-
-/* UART has only two receiving modes [Polling - Interrupt]. */
+/* UART receiving modes [Polling - Interrupt - Ring Buffer - DMA]. */
 #define UART_RECEIVE_USING_POLLING                         (0U)
 #define UART_RECEIVE_USING_INTERRUPT                       (1U)
+#define UART_RECEIVE_USING_RING_BUFFER                     (2U)
+#define UART_RECEIVE_USING_DMA                             (3U)
+
+/* UART transmitting modes [Polling - DMA - Ring Buffer]. */
+#define UART_TRANSMIT_USING_POLLING                        (0U)
+#define UART_TRANSMIT_USING_DMA                            (1U)
+#define UART_TRANSMIT_USING_RING_BUFFER                    (2U)
 
 /* The maximum and the minimum valid baud rate values. */
 #define UART_MIN_VALID_BAUDRATE                            (1200UL)
 #define UART_MAX_VALID_BAUDRATE                            (3000000UL)
 
+/* The baud rate error of a divider set by UART_setBaudRateDivider, it has no required baud rate to be compared to. */
+#define UART_UNKNOWN_BAUD_RATE_ERROR                       ((sint32)0X7FFFFFFFL)
+
 /*=====================================================================================================================
                                        < User-defined Data Types >
 =====================================================================================================================*/
@@ -56,20 +63,51 @@ typedef struct
 
 /* UART bit definitions. */
 #define UART_BRR_MANTISSA_FIELD                            (4U)
+#define UART_BRR_REGISTER_MASK                             (0XFFFFUL)
+#define UART_SR_IDLE_LINE_DETECTED_BIT                     (4U)
 #define UART_SR_DR_NOT_EMPTY_BIT                           (5U)
 #define UART_SR_TRANSMISSION_COMPLETE_BIT                  (6U)
+#define UART_SR_TRANSMIT_DR_EMPTY_BIT                      (7U)
 #define UART_CR1_RECEIVER_ENABLE_BIT                       (2U)
 #define UART_CR1_TRANSMITTER_ENABLE_BIT                    (3U)
+#define UART_CR1_IDLE_INTERRUPT_ENABLE_BIT                 (4U)
 #define UART_CR1_INTERRUPT_ENABLE_BIT                      (5U)
+#define UART_CR1_TRANSMIT_INTERRUPT_ENABLE_BIT             (7U)
 #define UART_CR1_PARITY_SELECTION_BIT                      (9U)
 #define UART_CR1_PARITY_ENABLE_BIT                         (10U)
 #define UART_CR1_UART_ENABLE_BIT                           (13U)
+#define UART_CR1_OVERSAMPLING_MODE_BIT                     (15U)
+#define UART_CR3_DMA_RECEIVER_BIT                          (6U)
+#define UART_CR3_DMA_TRANSMITTER_BIT                       (7U)
+
+/* The DMA streams and channels mapped to the UART transmitters and receivers [DMA request mapping in the reference manual]. */
+#define UART1_TX_DMA_CONTROLLER                            (DMA2_ID)
+#define UART1_TX_DMA_STREAM                                (DMA_STREAM7_ID)
+#define UART1_TX_DMA_CHANNEL                               (DMA_CHANNEL4_ID)
+#define UART2_TX_DMA_CONTROLLER                            (DMA1_ID)
+#define UART2_TX_DMA_STREAM                                (DMA_STREAM6_ID)
+#define UART2_TX_DMA_CHANNEL                               (DMA_CHANNEL4_ID)
+#define UART6_TX_DMA_CONTROLLER                            (DMA2_ID)
+#define UART6_TX_DMA_STREAM                                (DMA_STREAM6_ID)
+#define UART6_TX_DMA_CHANNEL                               (DMA_CHANNEL5_ID)
+#define UART1_RX_DMA_CONTROLLER                            (DMA2_ID)
+#define UART1_RX_DMA_STREAM                                (DMA_STREAM2_ID)
+#define UART1_RX_DMA_CHANNEL                               (DMA_CHANNEL4_ID)
+#define UART2_RX_DMA_CONTROLLER                            (DMA1_ID)
+#define UART2_RX_DMA_STREAM                                (DMA_STREAM5_ID)
+#define UART2_RX_DMA_CHANNEL                               (DMA_CHANNEL4_ID)
+#define UART6_RX_DMA_CONTROLLER                            (DMA2_ID)
+#define UART6_RX_DMA_STREAM                                (DMA_STREAM1_ID)
+#define UART6_RX_DMA_CHANNEL                               (DMA_CHANNEL5_ID)
 
 /*=====================================================================================================================
                                          < Function-like Macros >
 =====================================================================================================================*/
 
-/* Macro used to return the nearest integer value of the given float. */
-#define UART_ROUND_NUMBER(NUM) (NUM = (((uint8)((NUM - (uint32)NUM) * 10) >= 5) ? ((uint32)NUM + 1) : (uint32)NUM))
+/* Macro used to make sure the ring buffer data is written before the index that publishes it. */
+#define UART_MEMORY_BARRIER() __asm volatile ("dmb" ::: "memory")
+
+/* Macro used to check that the ring buffer size is a power of two, so the indices wrap using a mask. */
+#define UART_IS_POWER_OF_TWO(NUM) (((NUM) != 0) && (((NUM) & ((NUM) - 1)) == 0))
 
 #endif /* MCAL_UART_INCLUDES_UART_PRV_H_ */
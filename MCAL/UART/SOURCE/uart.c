@@ -15,23 +15,111 @@ Description  : Source file for the STM32F401xx UART peripheral driver.
 
 #include "../../../OTHERS/std_types.h"
 #include "../../../OTHERS/common_macros.h"
+#include "../../../OTHERS/bit_banding.h"
 #include "../INCLUDES/uart_prv.h"
 #include "../INCLUDES/uart_cfg.h"
 #include "../INCLUDES/uart.h"
+#include "../../DMA/INCLUDES/dma.h"
+#include "../../RCC/INCLUDES/rcc.h"
+#include "../../DWT/INCLUDES/dwt.h"
 
 /*=====================================================================================================================
                                            < Global Variables >
 =====================================================================================================================*/
 
+/* The error of the generated baud rate of each UART peripheral in parts per million. */
+static sint32 G_baudRateErrors[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+
 #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT)
 /* Array of pointers to function stores the addresses of the call-back functions. */
 static void (*G_callBackFunctionsArray[UART_NUMBER_OF_UART_PERIPHERALS])(uint8) = {NULL_PTR,NULL_PTR,NULL_PTR};
 #endif
 
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+/* The DMA controllers, streams and channels mapped to the UART transmitters. */
+static const DMA_controllerIDType G_transmitDMAControllers[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1_TX_DMA_CONTROLLER,UART2_TX_DMA_CONTROLLER,UART6_TX_DMA_CONTROLLER};
+static const DMA_streamIDType G_transmitDMAStreams[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1_TX_DMA_STREAM,UART2_TX_DMA_STREAM,UART6_TX_DMA_STREAM};
+static const DMA_channelIDType G_transmitDMAChannels[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1_TX_DMA_CHANNEL,UART2_TX_DMA_CHANNEL,UART6_TX_DMA_CHANNEL};
+
+/* Flags indicate that a DMA transmission is in progress on each UART peripheral. */
+static volatile uint8 G_transmitBusyFlags[UART_NUMBER_OF_UART_PERIPHERALS] = {FALSE,FALSE,FALSE};
+
+/* Array of pointers to function stores the addresses of the transmit call-back functions. */
+static void (*G_transmitCallBackFunctionsArray[UART_NUMBER_OF_UART_PERIPHERALS])(UART_errorStatusType) = {NULL_PTR,NULL_PTR,NULL_PTR};
+#endif
+
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER)
+#if(!UART_IS_POWER_OF_TWO(UART_TRANSMIT_RING_BUFFER_SIZE))
+#error "UART_TRANSMIT_RING_BUFFER_SIZE must be a power of two."
+#endif
+/* The transmit ring buffers, the head is moved by the application only and the tail is moved by the ISR only. */
+static uint8 G_transmitRingBuffers[UART_NUMBER_OF_UART_PERIPHERALS][UART_TRANSMIT_RING_BUFFER_SIZE];
+static volatile uint16 G_transmitRingHeads[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+static volatile uint16 G_transmitRingTails[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER)
+#if(!UART_IS_POWER_OF_TWO(UART_RECEIVE_RING_BUFFER_SIZE))
+#error "UART_RECEIVE_RING_BUFFER_SIZE must be a power of two."
+#endif
+/* The receive ring buffers, the head is moved by the ISR only and the tail is moved by the application only. */
+static uint8 G_receiveRingBuffers[UART_NUMBER_OF_UART_PERIPHERALS][UART_RECEIVE_RING_BUFFER_SIZE];
+static volatile uint16 G_receiveRingHeads[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+static volatile uint16 G_receiveRingTails[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA)
+/* The DMA controllers, streams and channels mapped to the UART receivers. */
+static const DMA_controllerIDType G_receiveDMAControllers[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1_RX_DMA_CONTROLLER,UART2_RX_DMA_CONTROLLER,UART6_RX_DMA_CONTROLLER};
+static const DMA_streamIDType G_receiveDMAStreams[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1_RX_DMA_STREAM,UART2_RX_DMA_STREAM,UART6_RX_DMA_STREAM};
+static const DMA_channelIDType G_receiveDMAChannels[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1_RX_DMA_CHANNEL,UART2_RX_DMA_CHANNEL,UART6_RX_DMA_CHANNEL};
+
+/* The circular reception buffers, their sizes, and the position of the first byte not delivered yet in each one. */
+static uint8* G_receiveDMABuffers[UART_NUMBER_OF_UART_PERIPHERALS] = {NULL_PTR,NULL_PTR,NULL_PTR};
+static uint16 G_receiveDMABufferSizes[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+static uint16 G_receiveDMALastPositions[UART_NUMBER_OF_UART_PERIPHERALS] = {0,0,0};
+
+/* Array of pointers to function stores the addresses of the frame call-back functions. */
+static void (*G_frameCallBackFunctionsArray[UART_NUMBER_OF_UART_PERIPHERALS])(uint8*, uint16, uint8) = {NULL_PTR,NULL_PTR,NULL_PTR};
+#endif
+
 /*=====================================================================================================================
                                           < Functions Definitions >
 =====================================================================================================================*/
 
+/*=====================================================================================================================
+ * [Function Name] : UART_getClockFrequency
+ * [Description]   : Get the current clock frequency of a specific UART from the RCC clock tree [UART1 and UART6 are
+ *                   on the APB2 bus - UART2 is on the APB1 bus].
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ * [return]        : The function returns the UART clock frequency in Hz.
+ ====================================================================================================================*/
+static uint32 UART_getClockFrequency(UART_peripheralIndexType a_peripheralIndex)
+{
+    uint32 LOC_clockFrequency = 0;
+    RCC_getBusClockFrequency(((a_peripheralIndex == UART2_ID) ? RCC_APB1_BUS : RCC_APB2_BUS),&LOC_clockFrequency);
+    return LOC_clockFrequency;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : UART_writeBaudRateDivider
+ * [Description]   : Write a specific baud rate divider into the BRR register and the oversampling mode bit.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_divider>          -> Indicates to the baud rate divider [BRR value + oversampling flag].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void UART_writeBaudRateDivider(UART_peripheralIndexType a_peripheralIndex, uint32 a_divider)
+{
+    UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
+    uint8 LOC_UARTStatus = GET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_UART_ENABLE_BIT);
+
+    /* The oversampling mode can be changed only while the UART is disabled. */
+    CLEAR_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_UART_ENABLE_BIT);
+    WRITE_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_OVERSAMPLING_MODE_BIT,((a_divider & UART_OVERSAMPLING_BY_8_FLAG) ? 1 : 0));
+    (*(LOC_ptr2UARTx + a_peripheralIndex))->BRR = (a_divider & UART_BRR_REGISTER_MASK);
+    WRITE_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_UART_ENABLE_BIT,LOC_UARTStatus);
+}
+
 /*=====================================================================================================================
  * [Function Name] : UART_setBaudRate
  * [Description]   : Set the required baud rate into the BRR register for specific UART.
@@ -41,34 +129,219 @@ static void (*G_callBackFunctionsArray[UART_NUMBER_OF_UART_PERIPHERALS])(uint8)
  ====================================================================================================================*/
 static void UART_setBaudRate(UART_peripheralIndexType a_peripheralIndex, uint32 a_baudRate)
 {
+    uint32 LOC_clockFrequency = UART_getClockFrequency(a_peripheralIndex);
+
+    /* Calculate the divider using integer division rounded to the nearest value, and keep the achieved error. */
+    UART_writeBaudRateDivider(a_peripheralIndex,UART_BAUD_RATE_DIVIDER(LOC_clockFrequency,a_baudRate));
+    *(G_baudRateErrors + a_peripheralIndex) = UART_BAUD_RATE_ERROR_PPM(LOC_clockFrequency,a_baudRate);
+}
+
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+/*=====================================================================================================================
+ * [Function Name] : UART_handleDMATransmission
+ * [Description]   : Release the transmitter of a specific UART when its DMA stream ends the transfer, then notify
+ *                   the application with the transmission status.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_event>            -> Indicates to the DMA event [Transfer Complete - Transfer Error].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void UART_handleDMATransmission(UART_peripheralIndexType a_peripheralIndex, DMA_interruptType a_event)
+{
+    UART_errorStatusType LOC_transmissionStatus = UART_NO_ERRORS;
+
+    /* The stream is disabled by hardware after both events, so the transmitter is free for the next transfer. */
+    if(a_event == DMA_TRANSFER_ERROR_INTERRUPT) LOC_transmissionStatus = UART_TRANSFER_ERROR;
+    *(G_transmitBusyFlags + a_peripheralIndex) = FALSE;
+
+    if(*(G_transmitCallBackFunctionsArray + a_peripheralIndex) != NULL_PTR)
+    {
+        /* Call the transmit call-back function and pass the transmission status to it. */
+        (*(G_transmitCallBackFunctionsArray + a_peripheralIndex))(LOC_transmissionStatus);
+    }
+}
+
+/* The DMA call-back functions of the UART transmitters, each one passes its UART index to the common handler. */
+static void UART1_DMATransmissionHandler(DMA_interruptType a_event) {UART_handleDMATransmission(UART1_ID,a_event);}
+static void UART2_DMATransmissionHandler(DMA_interruptType a_event) {UART_handleDMATransmission(UART2_ID,a_event);}
+static void UART6_DMATransmissionHandler(DMA_interruptType a_event) {UART_handleDMATransmission(UART6_ID,a_event);}
+
+/*=====================================================================================================================
+ * [Function Name] : UART_initDMATransmitter
+ * [Description]   : Configure the DMA stream mapped to the transmitter of a specific UART, and enable the UART DMA
+ *                   transmitter requests.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Transfer Error.
+ ====================================================================================================================*/
+static UART_errorStatusType UART_initDMATransmitter(UART_peripheralIndexType a_peripheralIndex)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
     UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
-    uint8 LOC_fraction = 0, LOC_carryFlag = 0;
-    uint16 LOC_mantissa = 0;
+    void (*LOC_ptr2DMAHandlers[UART_NUMBER_OF_UART_PERIPHERALS])(DMA_interruptType) = {UART1_DMATransmissionHandler,UART2_DMATransmissionHandler,UART6_DMATransmissionHandler};
+    DMA_streamConfigurationsType LOC_DMAConfigurations = {*(G_transmitDMAControllers + a_peripheralIndex),*(G_transmitDMAStreams + a_peripheralIndex),
+                                                          *(G_transmitDMAChannels + a_peripheralIndex),DMA_MEMORY_TO_PERIPHERAL,DMA_NORMAL_MODE,
+                                                          DMA_BYTE_SIZE,DMA_INCREMENTED_ADDRESS,DMA_FIXED_ADDRESS,DMA_MEDIUM_PRIORITY,
+                                                          (DMA_TRANSFER_ERROR_INTERRUPT | DMA_TRANSFER_COMPLETE_INTERRUPT)};
 
-    /* Calculate the USARTDIV factor using the given equation in the target reference manual. */
-    float32 LOC_USARTDIV = ((UART_CLOCK_FREQUECY / (float32)a_baudRate) / (float32)UART_OVERSAMPLING_VALUE);
+    if(DMA_configureStream(&LOC_DMAConfigurations) != DMA_NO_ERRORS)
+    {
+        LOC_errorStatus = UART_TRANSFER_ERROR;
+    }
 
-    /* Calculate the fraction part and round it to the nearest integer number. */
-    float32 LOC_fractionDIV = ((LOC_USARTDIV - (uint32)LOC_USARTDIV) * UART_OVERSAMPLING_VALUE);
-    UART_ROUND_NUMBER(LOC_fractionDIV);
+    else
+    {
+        *(G_transmitBusyFlags + a_peripheralIndex) = FALSE;
+        /* Route the stream events to the UART handler, then let the UART request the DMA when DR is empty. */
+        DMA_setCallBackFunction(*(G_transmitDMAControllers + a_peripheralIndex),*(G_transmitDMAStreams + a_peripheralIndex),*(LOC_ptr2DMAHandlers + a_peripheralIndex));
+        BIT_BAND_SET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR3,UART_CR3_DMA_TRANSMITTER_BIT);
+    }
 
-    if((uint8)LOC_fractionDIV >= UART_OVERSAMPLING_VALUE)
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : UART_startDMATransmission
+ * [Description]   : Hand a specific buffer to the DMA stream of a specific UART transmitter and return at once.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>       -> Pointer to the required buffer to be sent.
+ *                   <a_bufferSize>       -> Indicates to the buffer size.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Busy Error.
+ ====================================================================================================================*/
+static UART_errorStatusType UART_startDMATransmission(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+    UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
+
+    if(*(G_transmitBusyFlags + a_peripheralIndex) == TRUE)
     {
-        LOC_fraction = 0;
-        LOC_carryFlag = 1;
+        LOC_errorStatus = UART_BUSY_ERROR;
+    }
+
+    else if(a_bufferSize != 0)
+    {
+        *(G_transmitBusyFlags + a_peripheralIndex) = TRUE;
+        /* Clear the Transmission Complete flag before the DMA starts writing into the data register. */
+        CLEAR_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_TRANSMISSION_COMPLETE_BIT);
+
+        if(DMA_startTransfer(*(G_transmitDMAControllers + a_peripheralIndex),*(G_transmitDMAStreams + a_peripheralIndex), \
+                            (uint32)a_ptr2buffer,(uint32)&((*(LOC_ptr2UARTx + a_peripheralIndex))->DR),a_bufferSize) != DMA_NO_ERRORS)
+        {
+            *(G_transmitBusyFlags + a_peripheralIndex) = FALSE;
+            LOC_errorStatus = UART_BUSY_ERROR;
+        }
     }
 
     else
     {
-        LOC_fraction = (uint8)LOC_fractionDIV;
+        /* Do Nothing. */
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA)
+/*=====================================================================================================================
+ * [Function Name] : UART_processDMAReception
+ * [Description]   : Deliver the bytes written by the DMA since the last call to the frame call-back function as spans
+ *                   inside the circular buffer, a span that crosses the buffer end is delivered in two parts.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_isFrameEnd>       -> Indicates whether the line became idle [TRUE] or not [FALSE].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void UART_processDMAReception(UART_peripheralIndexType a_peripheralIndex, uint8 a_isFrameEnd)
+{
+    uint8* LOC_ptr2buffer = *(G_receiveDMABuffers + a_peripheralIndex);
+    uint16 LOC_bufferSize = *(G_receiveDMABufferSizes + a_peripheralIndex);
+    uint16 LOC_lastPosition = *(G_receiveDMALastPositions + a_peripheralIndex);
+    uint16 LOC_remainingData = LOC_bufferSize, LOC_position = 0;
+
+    /* The DMA write position is the buffer size minus the remaining data items of the current cycle. */
+    DMA_getRemainingData(*(G_receiveDMAControllers + a_peripheralIndex),*(G_receiveDMAStreams + a_peripheralIndex),&LOC_remainingData);
+    LOC_position = LOC_bufferSize - LOC_remainingData;
+
+    if((LOC_position != LOC_lastPosition) && (*(G_frameCallBackFunctionsArray + a_peripheralIndex) != NULL_PTR))
+    {
+        if(LOC_position > LOC_lastPosition)
+        {
+            (*(G_frameCallBackFunctionsArray + a_peripheralIndex))((LOC_ptr2buffer + LOC_lastPosition),(LOC_position - LOC_lastPosition),a_isFrameEnd);
+        }
+
+        else
+        {
+            /* The DMA wrapped around, deliver the part up to the buffer end, then the part from the buffer start. */
+            (*(G_frameCallBackFunctionsArray + a_peripheralIndex))((LOC_ptr2buffer + LOC_lastPosition),(LOC_bufferSize - LOC_lastPosition),((LOC_position == 0) ? a_isFrameEnd : FALSE));
+            if(LOC_position != 0) (*(G_frameCallBackFunctionsArray + a_peripheralIndex))(LOC_ptr2buffer,LOC_position,a_isFrameEnd);
+        }
     }
 
-    /* Calculate the mantissa part. */
-    LOC_mantissa = (uint16)((uint32)LOC_USARTDIV + LOC_carryFlag);
-    /* Set the required baud rate into the BRR register. */
-    (*(LOC_ptr2UARTx + a_peripheralIndex))->BRR = (((LOC_mantissa & 0X0FFF) << UART_BRR_MANTISSA_FIELD) | (LOC_fraction));
+    *(G_receiveDMALastPositions + a_peripheralIndex) = ((LOC_position == LOC_bufferSize) ? 0 : LOC_position);
 }
 
+/*=====================================================================================================================
+ * [Function Name] : UART_handleDMAReception
+ * [Description]   : Deliver the received data when the DMA fills half or all of the circular buffer, so the frames
+ *                   longer than half of the buffer are not overwritten before the line becomes idle.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_event>            -> Indicates to the DMA event [Half Transfer - Transfer Complete - Error].
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void UART_handleDMAReception(UART_peripheralIndexType a_peripheralIndex, DMA_interruptType a_event)
+{
+    if(a_event == DMA_TRANSFER_ERROR_INTERRUPT)
+    {
+        /* The stream is disabled by hardware after a transfer error, restart the reception from the buffer start. */
+        *(G_receiveDMALastPositions + a_peripheralIndex) = 0;
+        UART_startFrameReception(a_peripheralIndex,*(G_receiveDMABuffers + a_peripheralIndex),*(G_receiveDMABufferSizes + a_peripheralIndex));
+    }
+
+    else
+    {
+        UART_processDMAReception(a_peripheralIndex,FALSE);
+    }
+}
+
+/* The DMA call-back functions of the UART receivers, each one passes its UART index to the common handler. */
+static void UART1_DMAReceptionHandler(DMA_interruptType a_event) {UART_handleDMAReception(UART1_ID,a_event);}
+static void UART2_DMAReceptionHandler(DMA_interruptType a_event) {UART_handleDMAReception(UART2_ID,a_event);}
+static void UART6_DMAReceptionHandler(DMA_interruptType a_event) {UART_handleDMAReception(UART6_ID,a_event);}
+
+/*=====================================================================================================================
+ * [Function Name] : UART_initDMAReceiver
+ * [Description]   : Configure the DMA stream mapped to the receiver of a specific UART in the circular mode, then
+ *                   enable the UART DMA receiver requests and the IDLE line interrupt.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Transfer Error.
+ ====================================================================================================================*/
+static UART_errorStatusType UART_initDMAReceiver(UART_peripheralIndexType a_peripheralIndex)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+    UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
+    void (*LOC_ptr2DMAHandlers[UART_NUMBER_OF_UART_PERIPHERALS])(DMA_interruptType) = {UART1_DMAReceptionHandler,UART2_DMAReceptionHandler,UART6_DMAReceptionHandler};
+    DMA_streamConfigurationsType LOC_DMAConfigurations = {*(G_receiveDMAControllers + a_peripheralIndex),*(G_receiveDMAStreams + a_peripheralIndex),
+                                                          *(G_receiveDMAChannels + a_peripheralIndex),DMA_PERIPHERAL_TO_MEMORY,DMA_CIRCULAR_MODE,
+                                                          DMA_BYTE_SIZE,DMA_INCREMENTED_ADDRESS,DMA_FIXED_ADDRESS,DMA_HIGH_PRIORITY,
+                                                          (DMA_TRANSFER_ERROR_INTERRUPT | DMA_HALF_TRANSFER_INTERRUPT | DMA_TRANSFER_COMPLETE_INTERRUPT)};
+
+    if(DMA_configureStream(&LOC_DMAConfigurations) != DMA_NO_ERRORS)
+    {
+        LOC_errorStatus = UART_TRANSFER_ERROR;
+    }
+
+    else
+    {
+        *(G_receiveDMALastPositions + a_peripheralIndex) = 0;
+        /* Route the stream events to the UART handler, then let the UART request the DMA when DR is not empty. */
+        DMA_setCallBackFunction(*(G_receiveDMAControllers + a_peripheralIndex),*(G_receiveDMAStreams + a_peripheralIndex),*(LOC_ptr2DMAHandlers + a_peripheralIndex));
+        BIT_BAND_SET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR3,UART_CR3_DMA_RECEIVER_BIT);
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
 /*=====================================================================================================================
  * [Function Name] : UART_init
  * [Description]   : Initialize a specific UART peripheral with specific configurations.
@@ -80,6 +353,7 @@ static void UART_setBaudRate(UART_peripheralIndexType a_peripheralIndex, uint32
  *                                                          - Device Mode Error.
  *                                                          - Null Pointer Error.
  *                                                          - Parity Status Error.
+ *                                                          - Transfer Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_init(UART_peripheralIndexType a_peripheralIndex, UART_configurationsType* a_ptr2configurations)
 {
@@ -97,7 +371,8 @@ UART_errorStatusType UART_init(UART_peripheralIndexType a_peripheralIndex, UART_
     }
 
     else if((a_ptr2configurations->baudRate < UART_MIN_VALID_BAUDRATE) || \
-            (a_ptr2configurations->baudRate > UART_MAX_VALID_BAUDRATE))
+            (a_ptr2configurations->baudRate > UART_MAX_VALID_BAUDRATE) || \
+            (!UART_BAUD_RATE_IS_ACHIEVABLE(UART_getClockFrequency(a_peripheralIndex),a_ptr2configurations->baudRate)))
     {
         LOC_errorStatus = UART_BAUD_RATE_ERROR;
     }
@@ -131,9 +406,27 @@ UART_errorStatusType UART_init(UART_peripheralIndexType a_peripheralIndex, UART_
         /* Set the required baud rate. */
         UART_setBaudRate(a_peripheralIndex,a_ptr2configurations->baudRate);
 
-        /* If the interrupt mode is selected, enable the UART interrupt. */
-        #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT)
-        SET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_INTERRUPT_ENABLE_BIT);
+        /* If the ring buffer transmit mode is selected, empty the ring buffer. The TXE interrupt is enabled on writing. */
+        #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER)
+        BIT_BAND_CLEAR_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_TRANSMIT_INTERRUPT_ENABLE_BIT);
+        *(G_transmitRingHeads + a_peripheralIndex) = *(G_transmitRingTails + a_peripheralIndex) = 0;
+        #endif
+
+        /* If the interrupt or the ring buffer receive mode is selected, enable the UART receive interrupt. */
+        #if((UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT) || (UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER))
+        #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER)
+        *(G_receiveRingHeads + a_peripheralIndex) = *(G_receiveRingTails + a_peripheralIndex) = 0;
+        #endif
+        BIT_BAND_SET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_INTERRUPT_ENABLE_BIT);
+        #elif(UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA)
+        /* If the DMA receive mode is selected, the DMA reads the data and the IDLE interrupt marks the frames end. */
+        if(GET_BIT(a_ptr2configurations->deviceMode,0)) LOC_errorStatus = UART_initDMAReceiver(a_peripheralIndex);
+        BIT_BAND_SET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_IDLE_INTERRUPT_ENABLE_BIT);
+        #endif
+
+        /* If the DMA transmit mode is selected and the transmitter is enabled, prepare its DMA stream. */
+        #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+        if((LOC_errorStatus == UART_NO_ERRORS) && (GET_BIT(a_ptr2configurations->deviceMode,1))) LOC_errorStatus = UART_initDMATransmitter(a_peripheralIndex);
         #endif
 
         /* Enable the required UART peripheral to start the communication. */
@@ -150,27 +443,47 @@ UART_errorStatusType UART_init(UART_peripheralIndexType a_peripheralIndex, UART_
  *                   <a_byte>             -> Indicates to the required byte to be sent.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Index Error.
+ *                                                          - Busy Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_sendByte(UART_peripheralIndexType a_peripheralIndex, uint8 a_byte)
 {
     UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
     UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
 
+    DWT_BEGIN_PROBE(DWT_UART_SEND_BYTE_PROBE);
+
     if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
     {
         LOC_errorStatus = UART_INDEX_ERROR;
     }
 
+    #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+    else if(*(G_transmitBusyFlags + a_peripheralIndex) == TRUE)
+    {
+        LOC_errorStatus = UART_BUSY_ERROR;
+    }
+    #endif
+
     else
     {
+        #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER)
+        uint16 LOC_writtenBytes = 0;
+        /* Wait until there is a free place in the transmit ring buffer, then push the byte into it. */
+        while(LOC_writtenBytes == 0) UART_writeBuffer(a_peripheralIndex,&a_byte,1,&LOC_writtenBytes);
+        #else
+        /* Wait until the data register is empty, the last byte of a previous transfer may be still in it. */
+        while(BIT_IS_CLEAR((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_TRANSMIT_DR_EMPTY_BIT));
         /* Write the required byte into the data register. */
         (*(LOC_ptr2UARTx + a_peripheralIndex))->DR = a_byte;
         /* Wait until the frame transmission is complete, and the Transmission Complete flag is set. */
         while(BIT_IS_CLEAR((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_TRANSMISSION_COMPLETE_BIT));
         /* Clear the Transmission Complete flag. */
         CLEAR_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_TRANSMISSION_COMPLETE_BIT);
+        #endif
     }
 
+    DWT_END_PROBE(DWT_UART_SEND_BYTE_PROBE);
+
     return LOC_errorStatus;
 }
 
@@ -200,10 +513,16 @@ UART_errorStatusType UART_receiveByte(UART_peripheralIndexType a_peripheralIndex
 
     else
     {
+        #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER)
+        uint16 LOC_readBytes = 0;
+        /* Wait until the receive ring buffer has a byte, then pop it into the variable. */
+        while(LOC_readBytes == 0) UART_readBuffer(a_peripheralIndex,a_ptr2byte,1,&LOC_readBytes);
+        #else
         /* Wait until the data is ready to be read, and the DR Not Empty flag is set. */
         while(BIT_IS_CLEAR((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_DR_NOT_EMPTY_BIT));
         /* Read the data register and store the byte into the variable. */
         *a_ptr2byte = (*(LOC_ptr2UARTx + a_peripheralIndex))->DR;
+        #endif
     }
 
     return LOC_errorStatus;
@@ -212,12 +531,15 @@ UART_errorStatusType UART_receiveByte(UART_peripheralIndexType a_peripheralIndex
 /*=====================================================================================================================
  * [Function Name] : UART_sendBuffer
  * [Description]   : Send a specific buffer with a specific size using a specific UART peripheral.
+ *                   In the DMA transmit mode, the function starts the transfer and returns at once, and the buffer
+ *                   must stay valid until the transmit call-back function is called.
  * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
  *                   <a_ptr2buffer>       -> Pointer to the required buffer to be sent.
  *                   <a_bufferSize>       -> Indicates to the buffer size.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Index Error.
  *                                                          - Null Pointer Error.
+ *                                                          - Busy Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_sendBuffer(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint8 a_bufferSize)
 {
@@ -236,11 +558,16 @@ UART_errorStatusType UART_sendBuffer(UART_peripheralIndexType a_peripheralIndex,
 
     else
     {
+        #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+        /* Hand the whole buffer to the DMA stream and return without waiting. */
+        LOC_errorStatus = UART_startDMATransmission(a_peripheralIndex,a_ptr2buffer,a_bufferSize);
+        #else
         /* Loop on the buffer bytes and send them byte by byte. */
         for(uint8 LOC_iterator = 0; LOC_iterator < a_bufferSize; LOC_iterator++)
         {
             UART_sendByte(a_peripheralIndex,*(a_ptr2buffer + LOC_iterator));
         }
+        #endif
     }
 
     return LOC_errorStatus;
@@ -286,11 +613,14 @@ UART_errorStatusType UART_receiveBuffer(UART_peripheralIndexType a_peripheralInd
 /*=====================================================================================================================
  * [Function Name] : UART_sendString
  * [Description]   : Send a specific string using a specific UART peripheral.
+ *                   In the DMA transmit mode, the function starts the transfer and returns at once, and the string
+ *                   must stay valid until the transmit call-back function is called.
  * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
  *                   <a_ptr2string>       -> Pointer to the required string to be sent.
  * [return]        : The function returns the error status: - No Errors.
  *                                                          - Index Error.
  *                                                          - Null Pointer Error.
+ *                                                          - Busy Error [DMA transmit mode].
  ====================================================================================================================*/
 UART_errorStatusType UART_sendString(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2string)
 {
@@ -309,6 +639,13 @@ UART_errorStatusType UART_sendString(UART_peripheralIndexType a_peripheralIndex,
 
     else
     {
+        #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+        uint16 LOC_stringLength = 0;
+
+        /* Count the string characters, then hand them with the Null character to the DMA stream. */
+        while(*(a_ptr2string + LOC_stringLength) != NULL_CHAR) LOC_stringLength++;
+        LOC_errorStatus = UART_startDMATransmission(a_peripheralIndex,a_ptr2string,(LOC_stringLength + 1));
+        #else
         /* Loop on the string characters until the Null character and send them byte by byte. */
         for(uint8 LOC_iterator = 0; *(a_ptr2string + LOC_iterator) != NULL_CHAR; LOC_iterator++)
         {
@@ -317,6 +654,7 @@ UART_errorStatusType UART_sendString(UART_peripheralIndexType a_peripheralIndex,
 
         /* Send the Null character to indicate the end of the string. */
         UART_sendByte(a_peripheralIndex,NULL_CHAR);
+        #endif
     }
 
     return LOC_errorStatus;
@@ -368,6 +706,221 @@ UART_errorStatusType UART_receiveString(UART_peripheralIndexType a_peripheralInd
     return LOC_errorStatus;
 }
 
+/*=====================================================================================================================
+ * [Function Name] : UART_setBaudRateDivider
+ * [Description]   : Set a precomputed baud rate divider for a specific UART peripheral, the divider is usually a
+ *                   literal generated at compile time by UART_BAUD_RATE_DIVIDER, so no division is done at runtime.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_divider>          -> Indicates to the baud rate divider [BRR value + oversampling flag].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Baud Rate Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_setBaudRateDivider(UART_peripheralIndexType a_peripheralIndex, uint32 a_divider)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    /* The divider must have no bits other than BRR and the flag, and its mantissa [USARTDIV] must not be zero. */
+    else if((a_divider & ~(UART_OVERSAMPLING_BY_8_FLAG | UART_BRR_REGISTER_MASK)) || ((a_divider >> UART_BRR_MANTISSA_FIELD) & 0X0FFFUL) == 0)
+    {
+        LOC_errorStatus = UART_BAUD_RATE_ERROR;
+    }
+
+    else
+    {
+        UART_writeBaudRateDivider(a_peripheralIndex,a_divider);
+        *(G_baudRateErrors + a_peripheralIndex) = UART_UNKNOWN_BAUD_RATE_ERROR;
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : UART_getBaudRateError
+ * [Description]   : Get the error of the baud rate generated by UART_init from the required baud rate, the error is
+ *                   unknown after UART_setBaudRateDivider until the next UART_init.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_ptr2error>        -> Pointer to variable to store the error in parts per million.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ *                                                          - Baud Rate Error [Unknown Error].
+ ====================================================================================================================*/
+UART_errorStatusType UART_getBaudRateError(UART_peripheralIndexType a_peripheralIndex, sint32* a_ptr2error)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    else if(a_ptr2error == NULL_PTR)
+    {
+        LOC_errorStatus = UART_NULL_PTR_ERROR;
+    }
+
+    else if(*(G_baudRateErrors + a_peripheralIndex) == UART_UNKNOWN_BAUD_RATE_ERROR)
+    {
+        LOC_errorStatus = UART_BAUD_RATE_ERROR;
+    }
+
+    else
+    {
+        *a_ptr2error = *(G_baudRateErrors + a_peripheralIndex);
+    }
+
+    return LOC_errorStatus;
+}
+
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER)
+/*=====================================================================================================================
+ * [Function Name] : UART_writeBuffer
+ * [Description]   : Copy as many bytes as fit from a specific buffer into the transmit ring buffer of a specific
+ *                   UART peripheral without waiting, the bytes are sent later by the TXE interrupt.
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>           -> Pointer to the required buffer to be sent.
+ *                   <a_bufferSize>           -> Indicates to the buffer size.
+ *                   <a_ptr2writtenBytes>     -> Pointer to variable to store the number of the written bytes.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_writeBuffer(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize, uint16* a_ptr2writtenBytes)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+    UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    else if((a_ptr2buffer == NULL_PTR) || (a_ptr2writtenBytes == NULL_PTR))
+    {
+        LOC_errorStatus = UART_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* The indices are free-running, so their difference is the number of the bytes in the ring buffer. */
+        uint16 LOC_head = *(G_transmitRingHeads + a_peripheralIndex);
+        uint16 LOC_freeSpace = UART_TRANSMIT_RING_BUFFER_SIZE - (uint16)(LOC_head - *(G_transmitRingTails + a_peripheralIndex));
+        uint16 LOC_iterator = 0;
+
+        if(a_bufferSize < LOC_freeSpace) LOC_freeSpace = a_bufferSize;
+
+        for(LOC_iterator = 0; LOC_iterator < LOC_freeSpace; LOC_iterator++)
+        {
+            G_transmitRingBuffers[a_peripheralIndex][(uint16)(LOC_head + LOC_iterator) & (UART_TRANSMIT_RING_BUFFER_SIZE - 1)] = *(a_ptr2buffer + LOC_iterator);
+        }
+
+        /* Publish the new bytes to the ISR after they are stored, then make sure the TXE interrupt drains them. */
+        UART_MEMORY_BARRIER();
+        *(G_transmitRingHeads + a_peripheralIndex) = (uint16)(LOC_head + LOC_freeSpace);
+        if(LOC_freeSpace != 0) BIT_BAND_SET_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_TRANSMIT_INTERRUPT_ENABLE_BIT);
+
+        *a_ptr2writtenBytes = LOC_freeSpace;
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER)
+/*=====================================================================================================================
+ * [Function Name] : UART_readBuffer
+ * [Description]   : Copy up to a specific number of the received bytes from the receive ring buffer of a specific
+ *                   UART peripheral into a specific buffer without waiting.
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>           -> Pointer to a buffer to store the received data.
+ *                   <a_bufferSize>           -> Indicates to the buffer size.
+ *                   <a_ptr2readBytes>        -> Pointer to variable to store the number of the read bytes.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_readBuffer(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize, uint16* a_ptr2readBytes)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    else if((a_ptr2buffer == NULL_PTR) || (a_ptr2readBytes == NULL_PTR))
+    {
+        LOC_errorStatus = UART_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* The indices are free-running, so their difference is the number of the bytes in the ring buffer. */
+        uint16 LOC_tail = *(G_receiveRingTails + a_peripheralIndex);
+        uint16 LOC_availableBytes = (uint16)(*(G_receiveRingHeads + a_peripheralIndex) - LOC_tail);
+        uint16 LOC_iterator = 0;
+
+        if(a_bufferSize < LOC_availableBytes) LOC_availableBytes = a_bufferSize;
+
+        /* Make sure the bytes are read after the head that published them. */
+        UART_MEMORY_BARRIER();
+
+        for(LOC_iterator = 0; LOC_iterator < LOC_availableBytes; LOC_iterator++)
+        {
+            *(a_ptr2buffer + LOC_iterator) = G_receiveRingBuffers[a_peripheralIndex][(uint16)(LOC_tail + LOC_iterator) & (UART_RECEIVE_RING_BUFFER_SIZE - 1)];
+        }
+
+        /* Give the places back to the ISR after the bytes are copied. */
+        UART_MEMORY_BARRIER();
+        *(G_receiveRingTails + a_peripheralIndex) = (uint16)(LOC_tail + LOC_availableBytes);
+
+        *a_ptr2readBytes = LOC_availableBytes;
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
+#if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_DMA)
+/*=====================================================================================================================
+ * [Function Name] : UART_setTransmitCallBackFunction
+ * [Description]   : Set the address of the call-back function that is called when the DMA transmission ends.
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2callBackFunction> -> Pointer to the call-back function [takes the transmission status].
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_setTransmitCallBackFunction(UART_peripheralIndexType a_peripheralIndex, void (*a_ptr2callBackFunction)(UART_errorStatusType))
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    else if(a_ptr2callBackFunction == NULL_PTR)
+    {
+        LOC_errorStatus = UART_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* Store the address of the call-back function in the global array. */
+        *(G_transmitCallBackFunctionsArray + a_peripheralIndex) = a_ptr2callBackFunction;
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
 #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT)
 /*=====================================================================================================================
  * [Function Name] : UART_setCallBackFunction
@@ -400,6 +953,171 @@ UART_errorStatusType UART_setCallBackFunction(UART_peripheralIndexType a_periphe
 
     return LOC_errorStatus;
 }
+#endif
+
+#if(UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA)
+/*=====================================================================================================================
+ * [Function Name] : UART_startFrameReception
+ * [Description]   : Start receiving into a specific buffer using a circular DMA transfer. The received data is
+ *                   delivered in place to the frame call-back function on each idle line and each half of the buffer.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the required UART peripheral.
+ *                   <a_ptr2buffer>       -> Pointer to the circular buffer [must stay valid during the reception].
+ *                   <a_bufferSize>       -> Indicates to the buffer size.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ *                                                          - Buffer Size Error.
+ *                                                          - Transfer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_startFrameReception(UART_peripheralIndexType a_peripheralIndex, uint8* a_ptr2buffer, uint16 a_bufferSize)
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+    UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    else if(a_ptr2buffer == NULL_PTR)
+    {
+        LOC_errorStatus = UART_NULL_PTR_ERROR;
+    }
+
+    else if(a_bufferSize == 0)
+    {
+        LOC_errorStatus = UART_BUFFER_SIZE_ERROR;
+    }
+
+    else if(DMA_stopTransfer(*(G_receiveDMAControllers + a_peripheralIndex),*(G_receiveDMAStreams + a_peripheralIndex)) != DMA_NO_ERRORS)
+    {
+        LOC_errorStatus = UART_TRANSFER_ERROR;
+    }
+
+    else
+    {
+        *(G_receiveDMABuffers + a_peripheralIndex) = a_ptr2buffer;
+        *(G_receiveDMABufferSizes + a_peripheralIndex) = a_bufferSize;
+        *(G_receiveDMALastPositions + a_peripheralIndex) = 0;
+
+        /* The data register is the source and the circular buffer is the destination. */
+        if(DMA_startTransfer(*(G_receiveDMAControllers + a_peripheralIndex),*(G_receiveDMAStreams + a_peripheralIndex), \
+                             (uint32)&((*(LOC_ptr2UARTx + a_peripheralIndex))->DR),(uint32)a_ptr2buffer,a_bufferSize) != DMA_NO_ERRORS)
+        {
+            LOC_errorStatus = UART_TRANSFER_ERROR;
+        }
+    }
+
+    return LOC_errorStatus;
+}
+
+/*=====================================================================================================================
+ * [Function Name] : UART_setFrameCallBackFunction
+ * [Description]   : Set the address of the call-back function that receives the spans of the received frames.
+ *                   The call-back function takes a pointer to the span inside the circular buffer, the span length
+ *                   and a flag that is TRUE when the span is the end of a frame [the line became idle].
+ * [Arguments]     : <a_peripheralIndex>      -> Indicates to the required UART peripheral.
+ *                   <a_ptr2callBackFunction> -> Pointer to the call-back function.
+ * [return]        : The function returns the error status: - No Errors.
+ *                                                          - Index Error.
+ *                                                          - Null Pointer Error.
+ ====================================================================================================================*/
+UART_errorStatusType UART_setFrameCallBackFunction(UART_peripheralIndexType a_peripheralIndex, void (*a_ptr2callBackFunction)(uint8*, uint16, uint8))
+{
+    UART_errorStatusType LOC_errorStatus = UART_NO_ERRORS;
+
+    if((a_peripheralIndex != UART1_ID) && (a_peripheralIndex != UART2_ID) && (a_peripheralIndex != UART6_ID))
+    {
+        LOC_errorStatus = UART_INDEX_ERROR;
+    }
+
+    else if(a_ptr2callBackFunction == NULL_PTR)
+    {
+        LOC_errorStatus = UART_NULL_PTR_ERROR;
+    }
+
+    else
+    {
+        /* Store the address of the call-back function in the global array. */
+        *(G_frameCallBackFunctionsArray + a_peripheralIndex) = a_ptr2callBackFunction;
+    }
+
+    return LOC_errorStatus;
+}
+#endif
+
+#if((UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT) || (UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER) || \
+    (UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA) || (UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER))
+/*=====================================================================================================================
+ * [Function Name] : UART_handleInterrupt
+ * [Description]   : The common interrupt handler of all UART peripherals, serves the RXNE, IDLE and TXE events.
+ * [Arguments]     : <a_peripheralIndex>  -> Indicates to the UART peripheral that fired the interrupt.
+ * [return]        : The function returns void.
+ ====================================================================================================================*/
+static void UART_handleInterrupt(UART_peripheralIndexType a_peripheralIndex)
+{
+    UARTx_registersType* LOC_ptr2UARTx[UART_NUMBER_OF_UART_PERIPHERALS] = {UART1,UART2,UART6};
+
+    #if(UART_RECEIVE_MODE == UART_RECEIVE_USING_INTERRUPT)
+    if(BIT_IS_SET((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_DR_NOT_EMPTY_BIT))
+    {
+        /* Reading the data register clears the RXNE flag even if there is no call-back function. */
+        uint8 LOC_receivedByte = (*(LOC_ptr2UARTx + a_peripheralIndex))->DR;
+
+        if(*(G_callBackFunctionsArray + a_peripheralIndex) != NULL_PTR)
+        {
+            /* Call the call-back function and pass the Data Register value to it. */
+            (*(G_callBackFunctionsArray + a_peripheralIndex))(LOC_receivedByte);
+        }
+    }
+    #elif(UART_RECEIVE_MODE == UART_RECEIVE_USING_RING_BUFFER)
+    if(BIT_IS_SET((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_DR_NOT_EMPTY_BIT))
+    {
+        /* Reading the data register clears the RXNE flag, the byte is dropped if the ring buffer is full. */
+        uint8 LOC_receivedByte = (*(LOC_ptr2UARTx + a_peripheralIndex))->DR;
+        uint16 LOC_head = *(G_receiveRingHeads + a_peripheralIndex);
+
+        if((uint16)(LOC_head - *(G_receiveRingTails + a_peripheralIndex)) < UART_RECEIVE_RING_BUFFER_SIZE)
+        {
+            G_receiveRingBuffers[a_peripheralIndex][LOC_head & (UART_RECEIVE_RING_BUFFER_SIZE - 1)] = LOC_receivedByte;
+            UART_MEMORY_BARRIER();
+            *(G_receiveRingHeads + a_peripheralIndex) = (uint16)(LOC_head + 1);
+        }
+    }
+    #elif(UART_RECEIVE_MODE == UART_RECEIVE_USING_DMA)
+    if((BIT_IS_SET((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_IDLE_INTERRUPT_ENABLE_BIT)) && \
+       (BIT_IS_SET((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_IDLE_LINE_DETECTED_BIT)))
+    {
+        /* The IDLE flag is cleared by reading the status register then the data register. */
+        (void)((*(LOC_ptr2UARTx + a_peripheralIndex))->DR);
+
+        /* The line became idle, deliver the received bytes as the end of the current frame. */
+        if(*(G_receiveDMABuffers + a_peripheralIndex) != NULL_PTR) UART_processDMAReception(a_peripheralIndex,TRUE);
+    }
+    #endif
+
+    #if(UART_TRANSMIT_MODE == UART_TRANSMIT_USING_RING_BUFFER)
+    if((BIT_IS_SET((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_TRANSMIT_INTERRUPT_ENABLE_BIT)) && \
+       (BIT_IS_SET((*(LOC_ptr2UARTx + a_peripheralIndex))->SR,UART_SR_TRANSMIT_DR_EMPTY_BIT)))
+    {
+        uint16 LOC_tail = *(G_transmitRingTails + a_peripheralIndex);
+
+        if(LOC_tail != *(G_transmitRingHeads + a_peripheralIndex))
+        {
+            /* Move the next byte into the data register, then give its place back to the application. */
+            UART_MEMORY_BARRIER();
+            (*(LOC_ptr2UARTx + a_peripheralIndex))->DR = G_transmitRingBuffers[a_peripheralIndex][LOC_tail & (UART_TRANSMIT_RING_BUFFER_SIZE - 1)];
+            *(G_transmitRingTails + a_peripheralIndex) = (uint16)(LOC_tail + 1);
+        }
+
+        else
+        {
+            /* The ring buffer is empty, disable the TXE interrupt until the application writes again. */
+            BIT_BAND_CLEAR_BIT((*(LOC_ptr2UARTx + a_peripheralIndex))->CR1,UART_CR1_TRANSMIT_INTERRUPT_ENABLE_BIT);
+        }
+    }
+    #endif
+}
 
 /*=====================================================================================================================
  * [Function Name] : USART1_IRQHandler
@@ -409,11 +1127,9 @@ UART_errorStatusType UART_setCallBackFunction(UART_peripheralIndexType a_periphe
  ====================================================================================================================*/
 void USART1_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + UART1_ID) != NULL_PTR)
-    {
-        /* Call the UART1 call-back function and pass the Data Register value to it. */
-        (*(G_callBackFunctionsArray + UART1_ID))((*(LOC_ptr2UARTx + UART1_ID))->DR);
-    }
+    DWT_ISR_ENTER();
+    UART_handleInterrupt(UART1_ID);
+    DWT_ISR_EXIT();
 }
 
 /*=====================================================================================================================
@@ -424,11 +1140,9 @@ void USART1_IRQHandler(void)
  ====================================================================================================================*/
 void USART2_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + UART2_ID) != NULL_PTR)
-    {
-        /* Call the UART2 call-back function and pass the Data Register value to it. */
-        (*(G_callBackFunctionsArray + UART2_ID))((*(LOC_ptr2UARTx + UART2_ID))->DR);
-    }
+    DWT_ISR_ENTER();
+    UART_handleInterrupt(UART2_ID);
+    DWT_ISR_EXIT();
 }
 
 /*=====================================================================================================================
@@ -439,11 +1153,9 @@ void USART2_IRQHandler(void)
  ====================================================================================================================*/
 void USART6_IRQHandler(void)
 {
-    if(*(G_callBackFunctionsArray + UART6_ID) != NULL_PTR)
-    {
-        /* Call the UART6 call-back function and pass the Data Register value to it. */
-        (*(G_callBackFunctionsArray + UART6_ID))((*(LOC_ptr2UARTx + UART6_ID))->DR);
-    }
+    DWT_ISR_ENTER();
+    UART_handleInterrupt(UART6_ID);
+    DWT_ISR_EXIT();
 }
 #endif
 
@@ -0,0 +1,63 @@
+/*
+=======================================================================================================================
+Author       : Mamoun
+Module       : Bit Banding
+File Name    : bit_banding.h
+Date Created : Oct 17, 2026
+Description  : The ARM Cortex-M4 bit-band alias access macros.
+=======================================================================================================================
+*/
+
+
+#ifndef BIT_BANDING_H_
+#define BIT_BANDING_H_
+
+/*=====================================================================================================================
+                                < Definitions and Static Configurations >
+=====================================================================================================================*/
+
+/* Every bit in the first 1MB of the SRAM and the peripherals regions is mapped to a whole word in its alias region. */
+#define BIT_BAND_SRAM_BASE                   (0X20000000UL)
+#define BIT_BAND_SRAM_ALIAS_BASE             (0X22000000UL)
+#define BIT_BAND_PERIPHERAL_BASE             (0X40000000UL)
+#define BIT_BAND_PERIPHERAL_ALIAS_BASE       (0X42000000UL)
+#define BIT_BAND_REGION_SIZE                 (0X00100000UL)
+
+/*=====================================================================================================================
+                                         < Function-like Macros >
+=====================================================================================================================*/
+
+/*
+ * The bit-band macros are valid only for:
+ * - The variables in the first 1MB of the SRAM and the registers of the peripherals [APB1 - APB2 - AHB1 - AHB2]. The
+ *   core peripherals [NVIC - SCB - SysTick - DWT] are on the private peripheral bus and have no bit-band alias.
+ * - The registers without write-1-to-clear flags [e.g. EXTI->PR], a write to an alias is done by the bus matrix as an
+ *   atomic read-modify-write of the whole word, so the other set flags would be written back and cleared.
+ * The alias address is calculated at compile time when the address of the register is a constant.
+ */
+
+/* Get the alias word address of a certain bit at a specific address in one of the two bit-band regions. */
+#define BIT_BAND_ALIAS_ADDRESS(ADDRESS,BIT) (((uint32)(ADDRESS) & 0XF0000000UL) + 0X02000000UL + (((uint32)(ADDRESS) & 0X000FFFFFUL) << 5) + ((uint32)(BIT) << 2))
+
+/* Access the alias word of a certain bit in any bit-band register or variable. */
+#define BIT_BAND_ALIAS(REG,BIT) (*((volatile uint32*)BIT_BAND_ALIAS_ADDRESS(&(REG),BIT)))
+
+/* Check if a specific address is in one of the two bit-band regions and return one if yes */
+#define BIT_BAND_IS_VALID_ADDRESS(ADDRESS) ((((uint32)(ADDRESS) - BIT_BAND_SRAM_BASE) < BIT_BAND_REGION_SIZE) || (((uint32)(ADDRESS) - BIT_BAND_PERIPHERAL_BASE) < BIT_BAND_REGION_SIZE))
+
+/* Set a certain bit in any bit-band register [atomically] */
+#define BIT_BAND_SET_BIT(REG,BIT) (BIT_BAND_ALIAS(REG,BIT) = 1UL)
+
+/* Clear a certain bit in any bit-band register [atomically] */
+#define BIT_BAND_CLEAR_BIT(REG,BIT) (BIT_BAND_ALIAS(REG,BIT) = 0UL)
+
+/* Write a value [1 or 0] in a certain bit in any bit-band register [atomically] */
+#define BIT_BAND_WRITE_BIT(REG,BIT,VAL) (BIT_BAND_ALIAS(REG,BIT) = ((uint32)(VAL) & 0X01UL))
+
+/* Toggle a certain bit in any bit-band register, the other bits are never rewritten */
+#define BIT_BAND_TOGGLE_BIT(REG,BIT) (BIT_BAND_ALIAS(REG,BIT) ^= 1UL)
+
+/* Get the value of a certain bit (1 or 0) in any bit-band register */
+#define BIT_BAND_GET_BIT(REG,BIT) (BIT_BAND_ALIAS(REG,BIT))
+
+#endif /* BIT_BANDING_H_ */
@@ -100,4 +100,15 @@ Description  : The most common macros used in Embedded C.
 /* Used in the CONCAT_32_BITS macro to prevent doing macros replacement before object replacement. */
 #define CONCAT_32_HELPER(BIT31,BIT30,BIT29,BIT28,BIT27,BIT26,BIT25,BIT24,BIT23,BIT22,BIT21,BIT20,BIT19,BIT18,BIT17,BIT16,BIT15,BIT14,BIT13,BIT12,BIT11,BIT10,BIT9,BIT8,BIT7,BIT6,BIT5,BIT4,BIT3,BIT2,BIT1,BIT0) (0b##BIT31##BIT30##BIT29##BIT28##BIT27##BIT26##BIT25##BIT24##BIT23##BIT22##BIT21##BIT20##BIT19##BIT18##BIT17##BIT16##BIT15##BIT14##BIT13##BIT12##BIT11##BIT10##BIT9##BIT8##BIT7##BIT6##BIT5##BIT4##BIT3##BIT2##BIT1##BIT0)
 
+/*
+ * The critical section macros save and restore the interrupts mask, so the critical sections can be nested and can
+ * be used from the interrupts handlers.
+ */
+
+/* Save the current interrupts mask [PRIMASK] in a uint32 variable, then disable all the maskable interrupts */
+#define ENTER_CRITICAL_SECTION(STATE) __asm volatile ("MRS %0, PRIMASK\n\tCPSID i" : "=r" (STATE) :: "memory")
+
+/* Restore the interrupts mask [PRIMASK] saved by ENTER_CRITICAL_SECTION */
+#define EXIT_CRITICAL_SECTION(STATE) __asm volatile ("MSR PRIMASK, %0" :: "r" (STATE) : "memory")
+
 #endif /* COMMON_MACROS_H_ */